@@ -99,3 +99,18 @@ function(qsk_add_example target)
     target_include_directories(${target} PRIVATE ${CMAKE_CURRENT_LIST_DIR})
 
 endfunction()
+
+function(qsk_add_test target)
+
+    qsk_add_executable(${target} ${ARGN})
+
+    set_target_properties(${target} PROPERTIES FOLDER tests)
+    target_link_libraries(${target} PRIVATE qskinny qsktestsupport Qt::Test)
+
+    add_test(NAME ${target} COMMAND ${target})
+
+    # no display/GPU needed
+    set_tests_properties(${target} PROPERTIES
+        ENVIRONMENT "QT_QPA_PLATFORM=offscreen;QT_QUICK_BACKEND=software")
+
+endfunction()
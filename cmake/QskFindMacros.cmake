@@ -63,6 +63,13 @@ macro(qsk_setup_Qt)
             message(STATUS "No Qt/Quick WebEngine support: skipping some unimportant examples")
         endif()
     endif()
+
+    if(BUILD_TESTS)
+        find_package(Qt${QT_VERSION_MAJOR} QUIET OPTIONAL_COMPONENTS Test)
+        if (NOT Qt${QT_VERSION_MAJOR}Test_FOUND)
+            message(STATUS "No Qt/Test support: skipping the tests")
+        endif()
+    endif()
 endmacro()
 
 macro(qsk_setup_Hunspell)
@@ -275,22 +275,28 @@ MainItem::MainItem( QQuickItem* parent )
 
     connect( m_cube, &Cube::cubeIndexChanged, m_menuBar, &MenuBar::setActivePage );
 
-    auto* const dashboardPage = new DashboardPage( m_cube );
-    auto* const roomsPage = new RoomsPage( m_cube );
-    auto* const devicesPage = new DevicesPage( m_cube );
-    auto* const statisticsPage = new StatisticsPage( m_cube );
-    auto* const storagePage = new StoragePage( m_cube );
-    auto* const membersPage = new MembersPage( m_cube );
-
-    m_cube->insertItem( Cube::LeftPos, statisticsPage );
-    m_cube->insertItem( Cube::RightPos, roomsPage );
-    m_cube->insertItem( Cube::TopPos, storagePage );
-    m_cube->insertItem( Cube::BottomPos, membersPage );
-    m_cube->insertItem( Cube::FrontPos, dashboardPage );
-    m_cube->insertItem( Cube::BackPos, devicesPage );
+    // the pages are created, when being shown for the first time
+
+    m_cube->insertPage( Cube::LeftPos,
+        [this]() { return new StatisticsPage( m_cube ); } );
+
+    m_cube->insertPage( Cube::RightPos,
+        [this]() { return new RoomsPage( m_cube ); } );
+
+    m_cube->insertPage( Cube::TopPos,
+        [this]() { return new StoragePage( m_cube ); } );
+
+    m_cube->insertPage( Cube::BottomPos,
+        [this]() { return new MembersPage( m_cube ); } );
+
+    m_cube->insertPage( Cube::FrontPos,
+        [this]() { return new DashboardPage( m_cube ); } );
+
+    m_cube->insertPage( Cube::BackPos,
+        [this]() { return new DevicesPage( m_cube ); } );
 
     // the current item needs to be the one at the Front:
-    m_cube->setCurrentItem( dashboardPage );
+    m_cube->setCurrentIndex( Cube::FrontPos );
 }
 
 void MainItem::gestureEvent( QskGestureEvent* event )
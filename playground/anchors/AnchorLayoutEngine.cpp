@@ -0,0 +1,495 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) 2016 Uwe Rathmann
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#include "AnchorLayoutEngine.h"
+
+#include "kiwi/Solver.h"
+#include "kiwi/Constraint.h"
+#include "kiwi/Variable.h"
+#include "kiwi/Expression.h"
+
+#include <QskQuick.h>
+
+#include <qrect.h>
+#include <qvector.h>
+
+#include <limits>
+#include <map>
+#include <set>
+#include <vector>
+
+static inline Qt::Orientation qskOrientation( int edge )
+{
+    return ( edge <= Qt::AnchorRight ) ? Qt::Horizontal : Qt::Vertical;
+}
+
+namespace
+{
+    using Constraints = std::vector< Constraint >;
+
+    class Geometry
+    {
+      public:
+        Expression expressionAt( int anchorPoint ) const
+        {
+            switch( anchorPoint )
+            {
+                case Qt::AnchorLeft:
+                    return Term( m_left );
+
+                case Qt::AnchorHorizontalCenter:
+                    return centerH();
+
+                case Qt::AnchorRight:
+                    return right();
+
+                case Qt::AnchorTop:
+                    return Term( m_top );
+
+                case Qt::AnchorVerticalCenter:
+                    return centerV();
+
+                case Qt::AnchorBottom:
+                    return bottom();
+            }
+
+            return Expression();
+        }
+
+        inline const Variable& length( Qt::Orientation orientation ) const
+        {
+            return ( orientation == Qt::Horizontal ) ? m_width : m_height;
+        }
+
+        inline QRectF rect() const
+        {
+            return QRectF( m_left.value(), m_top.value(),
+                m_width.value(), m_height.value() );
+        }
+
+        inline Expression centerH() const { return m_left + 0.5 * m_width; }
+        inline Expression centerV() const { return m_top + 0.5 * m_height; }
+        inline Expression right() const { return m_left + m_width; }
+        inline Expression bottom() const { return m_top + m_height; }
+
+        inline const Variable& left() const { return m_left; }
+        inline const Variable& top() const { return m_top; }
+        inline const Variable& width() const { return m_width; }
+        inline const Variable& height() const { return m_height; }
+
+      private:
+        Variable m_left, m_top, m_width, m_height;
+    };
+
+    using Geometries = std::map< const QQuickItem*, Geometry >;
+
+    class Anchor
+    {
+      public:
+        QQuickItem* item1 = nullptr;
+        Qt::AnchorPoint edge1;
+
+        QQuickItem* item2 = nullptr;
+        Qt::AnchorPoint edge2;
+    };
+
+    class LayoutSolver : public Solver
+    {
+      public:
+        LayoutSolver( bool layoutChildren );
+
+        // the constraints are in the same order as the anchors of the engine
+        void appendAnchor( const Anchor&, const Geometries& );
+        void removeAnchorAt( int index );
+
+        void updateSizeConstraints( const QQuickItem*, const Geometry& );
+        void removeSizeConstraints( const QQuickItem* );
+
+        void setEditable( bool );
+
+        QSizeF resolvedSize();
+        QSizeF resolvedSize( qreal width, qreal height );
+
+        void resolve( qreal width, qreal height );
+
+      private:
+        void addSizeConstraints( Constraints&, const Geometry&,
+            const QSizeF&, RelationalOperator, double strength );
+
+        void addConstraints( Constraints&, const Constraint& );
+        void removeConstraints( const Constraints& );
+
+        const bool m_layoutChildren;
+
+        Variable m_width, m_height;
+
+        QVector< Constraints > m_anchorConstraints;
+        std::map< const QQuickItem*, Constraints > m_sizeConstraints;
+    };
+}
+
+LayoutSolver::LayoutSolver( bool layoutChildren )
+    : m_layoutChildren( layoutChildren )
+{
+}
+
+void LayoutSolver::appendAnchor( const Anchor& anchor, const Geometries& geometries )
+{
+    Constraints constraints;
+
+    const auto& r1 = geometries.at( anchor.item1 );
+    const auto expr1 = r1.expressionAt( anchor.edge1 );
+
+    if ( anchor.item2 == nullptr )
+    {
+        Expression expr2;
+
+        switch( anchor.edge2 )
+        {
+            case Qt::AnchorLeft:
+            case Qt::AnchorTop:
+                expr2 = 0;
+                break;
+
+            case Qt::AnchorHorizontalCenter:
+                expr2 = Term( 0.5 * m_width );
+                break;
+
+            case Qt::AnchorRight:
+                expr2 = Term( m_width );
+                break;
+
+            case Qt::AnchorVerticalCenter:
+                expr2 = Term( 0.5 * m_height );
+                break;
+
+            case Qt::AnchorBottom:
+                expr2 = Term( m_height );
+                break;
+        }
+
+        addConstraints( constraints, expr1 == expr2 );
+    }
+    else
+    {
+        const auto& r2 = geometries.at( anchor.item2 );
+        const auto expr2 = r2.expressionAt( anchor.edge2 );
+
+        addConstraints( constraints, expr1 == expr2 );
+
+        if ( m_layoutChildren )
+        {
+            const auto o = qskOrientation( anchor.edge1 );
+
+            /*
+                A constraint with medium strength to make anchored item
+                being stretched according to their stretch factors s1, s2.
+                ( For the moment we don't support having specific factors. )
+             */
+            const auto s1 = 1.0;
+            const auto s2 = 1.0;
+
+            const Constraint c( r1.length( o ) * s1 == r2.length( o ) * s2,
+                Strength::medium );
+
+            addConstraints( constraints, c );
+        }
+    }
+
+    m_anchorConstraints += constraints;
+}
+
+void LayoutSolver::removeAnchorAt( int index )
+{
+    removeConstraints( m_anchorConstraints[ index ] );
+    m_anchorConstraints.removeAt( index );
+}
+
+void LayoutSolver::updateSizeConstraints(
+    const QQuickItem* item, const Geometry& geometry )
+{
+    auto& constraints = m_sizeConstraints[ item ];
+
+    removeConstraints( constraints );
+    constraints.clear();
+
+    const auto minSize = qskSizeConstraint( item, Qt::MinimumSize );
+    addSizeConstraints( constraints, geometry, minSize, OP_GE, Strength::required );
+
+    const auto maxSize = qskSizeConstraint( item, Qt::MaximumSize );
+    addSizeConstraints( constraints, geometry, maxSize, OP_LE, Strength::required );
+
+    const auto prefSize = qskSizeConstraint( item, Qt::PreferredSize );
+    addSizeConstraints( constraints, geometry, prefSize, OP_EQ, Strength::strong );
+}
+
+void LayoutSolver::removeSizeConstraints( const QQuickItem* item )
+{
+    const auto it = m_sizeConstraints.find( item );
+    if ( it != m_sizeConstraints.end() )
+    {
+        removeConstraints( it->second );
+        m_sizeConstraints.erase( it );
+    }
+}
+
+void LayoutSolver::setEditable( bool on )
+{
+    if ( on == hasEditVariable( m_width ) )
+        return;
+
+    if ( on )
+    {
+        const double strength = 0.9 * Strength::required;
+
+        addEditVariable( m_width, strength );
+        addEditVariable( m_height, strength );
+    }
+    else
+    {
+        removeEditVariable( m_width );
+        removeEditVariable( m_height );
+    }
+}
+
+void LayoutSolver::resolve( qreal width, qreal height )
+{
+    suggestValue( m_width, width );
+    suggestValue( m_height, height );
+    updateVariables();
+}
+
+QSizeF LayoutSolver::resolvedSize()
+{
+    updateVariables();
+    return QSizeF( m_width.value(), m_height.value() );
+}
+
+QSizeF LayoutSolver::resolvedSize( qreal width, qreal height )
+{
+    resolve( width, height );
+    return QSizeF( m_width.value(), m_height.value() );
+}
+
+void LayoutSolver::addSizeConstraints( Constraints& constraints,
+    const Geometry& rect, const QSizeF& size, RelationalOperator op, double strength )
+{
+    if ( size.width() >= 0.0 )
+    {
+        const Constraint c( rect.width() - size.width(), op, strength );
+        addConstraints( constraints, c );
+    }
+
+    if ( size.height() >= 0.0 )
+    {
+        const Constraint c( rect.height() - size.height(), op, strength );
+        addConstraints( constraints, c );
+    }
+}
+
+inline void LayoutSolver::addConstraints(
+    Constraints& constraints, const Constraint& constraint )
+{
+    addConstraint( constraint );
+    constraints.push_back( constraint );
+}
+
+inline void LayoutSolver::removeConstraints( const Constraints& constraints )
+{
+    for ( const auto& constraint : constraints )
+        removeConstraint( constraint );
+}
+
+class AnchorLayoutEngine::PrivateData
+{
+  public:
+    PrivateData()
+        : hintSolver( false )
+        , layoutSolver( true )
+    {
+        layoutSolver.setEditable( true );
+    }
+
+    inline void invalidateHints()
+    {
+        hasValidHints = false;
+    }
+
+    void updateSizeConstraints()
+    {
+        for ( auto item : std::as_const( dirtyItems ) )
+        {
+            const auto& geometry = geometries.at( item );
+
+            hintSolver.updateSizeConstraints( item, geometry );
+            layoutSolver.updateSizeConstraints( item, geometry );
+        }
+
+        dirtyItems.clear();
+    }
+
+    Geometries geometries;
+    QVector< Anchor > anchors;
+
+    // items, where the size constraints need to be updated
+    std::set< const QQuickItem* > dirtyItems;
+
+    /*
+        Calculating the hints and the geometries are done
+        by different solvers, as the layout solver has
+        additional constraints for stretching the children.
+     */
+    LayoutSolver hintSolver;
+    LayoutSolver layoutSolver;
+
+    QSizeF hints[3];
+    bool hasValidHints = false;
+};
+
+AnchorLayoutEngine::AnchorLayoutEngine()
+    : m_data( new PrivateData )
+{
+}
+
+AnchorLayoutEngine::~AnchorLayoutEngine()
+{
+}
+
+void AnchorLayoutEngine::addAnchor( QQuickItem* item1, Qt::AnchorPoint edge1,
+    QQuickItem* item2, Qt::AnchorPoint edge2 )
+{
+    if ( item1 == nullptr || item1 == item2 )
+        return;
+
+    for ( auto item : { item1, item2 } )
+    {
+        if ( item && m_data->geometries.find( item ) == m_data->geometries.end() )
+        {
+            (void)m_data->geometries[ item ];
+            m_data->dirtyItems.insert( item );
+        }
+    }
+
+    Anchor anchor;
+    anchor.item1 = item1;
+    anchor.edge1 = edge1;
+    anchor.item2 = item2;
+    anchor.edge2 = edge2;
+
+    m_data->anchors += anchor;
+
+    m_data->hintSolver.appendAnchor( anchor, m_data->geometries );
+    m_data->layoutSolver.appendAnchor( anchor, m_data->geometries );
+
+    m_data->invalidateHints();
+}
+
+void AnchorLayoutEngine::removeItem( const QQuickItem* item )
+{
+    auto it = m_data->geometries.find( item );
+    if ( it == m_data->geometries.end() )
+        return;
+
+    auto& anchors = m_data->anchors;
+
+    for ( int i = anchors.count() - 1; i >= 0; i-- )
+    {
+        const auto& anchor = anchors[i];
+
+        if ( anchor.item1 == item || anchor.item2 == item )
+        {
+            m_data->hintSolver.removeAnchorAt( i );
+            m_data->layoutSolver.removeAnchorAt( i );
+
+            anchors.removeAt( i );
+        }
+    }
+
+    m_data->hintSolver.removeSizeConstraints( item );
+    m_data->layoutSolver.removeSizeConstraints( item );
+
+    m_data->dirtyItems.erase( item );
+    m_data->geometries.erase( it );
+
+    m_data->invalidateHints();
+}
+
+bool AnchorLayoutEngine::hasItem( const QQuickItem* item ) const
+{
+    return m_data->geometries.find( item ) != m_data->geometries.end();
+}
+
+int AnchorLayoutEngine::itemCount() const
+{
+    return static_cast< int >( m_data->geometries.size() );
+}
+
+int AnchorLayoutEngine::anchorCount() const
+{
+    return m_data->anchors.count();
+}
+
+void AnchorLayoutEngine::invalidate( const QQuickItem* item )
+{
+    if ( hasItem( item ) )
+    {
+        m_data->dirtyItems.insert( item );
+        m_data->invalidateHints();
+    }
+}
+
+void AnchorLayoutEngine::invalidate()
+{
+    for ( const auto& geometry : m_data->geometries )
+        m_data->dirtyItems.insert( geometry.first );
+
+    m_data->invalidateHints();
+}
+
+QSizeF AnchorLayoutEngine::sizeHint( Qt::SizeHint which )
+{
+    if ( which < Qt::MinimumSize || which > Qt::MaximumSize )
+        return QSizeF();
+
+    if ( !m_data->hasValidHints )
+    {
+        m_data->updateSizeConstraints();
+
+        /*
+             The solver seems to run into overflows with
+             std::numeric_limits< unsigned float >::max()
+         */
+        const qreal max = std::numeric_limits< unsigned int >::max();
+
+        auto& solver = m_data->hintSolver;
+        auto& hints = m_data->hints;
+
+        solver.setEditable( false );
+        hints[ Qt::PreferredSize ] = solver.resolvedSize();
+
+        solver.setEditable( true );
+        hints[ Qt::MinimumSize ] = solver.resolvedSize( 0.0, 0.0 );
+        hints[ Qt::MaximumSize ] = solver.resolvedSize( max, max );
+
+        m_data->hasValidHints = true;
+    }
+
+    return m_data->hints[ which ];
+}
+
+void AnchorLayoutEngine::setGeometries( const QRectF& rect )
+{
+    m_data->updateSizeConstraints();
+    m_data->layoutSolver.resolve( rect.width(), rect.height() );
+
+    const auto& geometries = m_data->geometries;
+    for ( auto it = geometries.begin(); it != geometries.end(); ++it )
+    {
+        auto r = it->second.rect();
+        r.translate( rect.left(), rect.top() );
+
+        qskSetItemGeometry( const_cast< QQuickItem* >( it->first ), r );
+    }
+}
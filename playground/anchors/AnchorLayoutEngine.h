@@ -0,0 +1,54 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) 2016 Uwe Rathmann
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#pragma once
+
+#include <qnamespace.h>
+#include <memory>
+
+class QQuickItem;
+class QSizeF;
+class QRectF;
+
+/*
+    The constraints of the anchors and the size hints of the items
+    are kept in solvers, that live as long as the engine. Changes are
+    applied incrementally: adding/removing an anchor adds/removes
+    its constraints only, and when the size hints of an item have changed
+    only the constraints of this item are replaced. The size of the
+    layout rectangle is passed as suggestion for an edit variable.
+ */
+class AnchorLayoutEngine
+{
+  public:
+    AnchorLayoutEngine();
+    ~AnchorLayoutEngine();
+
+    // item2 == nullptr: anchoring to the layout rectangle
+    void addAnchor( QQuickItem* item1, Qt::AnchorPoint edge1,
+        QQuickItem* item2, Qt::AnchorPoint edge2 );
+
+    // removes the item and all anchors it is involved in
+    void removeItem( const QQuickItem* );
+
+    bool hasItem( const QQuickItem* ) const;
+    int itemCount() const;
+    int anchorCount() const;
+
+    // the size hints of an item have changed
+    void invalidate( const QQuickItem* );
+
+    // the size hints of all items have changed
+    void invalidate();
+
+    QSizeF sizeHint( Qt::SizeHint );
+    void setGeometries( const QRectF& );
+
+  private:
+    Q_DISABLE_COPY( AnchorLayoutEngine )
+
+    class PrivateData;
+    std::unique_ptr< PrivateData > m_data;
+};
@@ -0,0 +1,109 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) 2016 Uwe Rathmann
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#include "AnchorBenchmark.h"
+#include "AnchorLayoutEngine.h"
+
+#include <QskControl.h>
+
+static const int qskIterations = 1000;
+
+AnchorBenchmark::AnchorBenchmark()
+    : Benchmark( "anchors" )
+{
+    for ( auto& item : m_items )
+    {
+        item = new QskControl( &m_parent );
+
+        item->setMinimumSize( 10, 10 );
+        item->setPreferredSize( 100, 100 );
+        item->setMaximumSize( 1000, 1000 );
+    }
+}
+
+void AnchorBenchmark::execute()
+{
+    for ( int i = 0; i < qskIterations; i++ )
+    {
+        changeHints( i );
+
+        AnchorLayoutEngine engine;
+        setup( engine );
+
+        layout( engine, i );
+    }
+
+    report( "full", qskIterations );
+
+    AnchorLayoutEngine engine;
+    setup( engine );
+
+    for ( int i = 0; i < qskIterations; i++ )
+    {
+        changeHints( i );
+        engine.invalidate( m_items[2] );
+
+        layout( engine, i );
+    }
+
+    report( "incremental", qskIterations );
+}
+
+void AnchorBenchmark::setup( AnchorLayoutEngine& engine ) const
+{
+    const auto a = m_items[0];
+    const auto b = m_items[1];
+    const auto c = m_items[2];
+    const auto d = m_items[3];
+    const auto e = m_items[4];
+    const auto f = m_items[5];
+    const auto g = m_items[6];
+
+    engine.addAnchor( a, Qt::AnchorTop, nullptr, Qt::AnchorTop );
+    engine.addAnchor( b, Qt::AnchorTop, nullptr, Qt::AnchorTop );
+
+    engine.addAnchor( c, Qt::AnchorTop, a, Qt::AnchorBottom );
+    engine.addAnchor( c, Qt::AnchorTop, b, Qt::AnchorBottom );
+    engine.addAnchor( c, Qt::AnchorBottom, d, Qt::AnchorTop );
+    engine.addAnchor( c, Qt::AnchorBottom, e, Qt::AnchorTop );
+
+    engine.addAnchor( d, Qt::AnchorBottom, nullptr, Qt::AnchorBottom );
+    engine.addAnchor( e, Qt::AnchorBottom, nullptr, Qt::AnchorBottom );
+
+    engine.addAnchor( c, Qt::AnchorTop, f, Qt::AnchorTop );
+    engine.addAnchor( c, Qt::AnchorVerticalCenter, f, Qt::AnchorBottom );
+    engine.addAnchor( f, Qt::AnchorBottom, g, Qt::AnchorTop );
+    engine.addAnchor( c, Qt::AnchorBottom, g, Qt::AnchorBottom );
+
+    // horizontal
+    engine.addAnchor( a, Qt::AnchorLeft, nullptr, Qt::AnchorLeft );
+    engine.addAnchor( d, Qt::AnchorLeft, nullptr, Qt::AnchorLeft );
+    engine.addAnchor( a, Qt::AnchorRight, b, Qt::AnchorLeft );
+
+    engine.addAnchor( a, Qt::AnchorRight, c, Qt::AnchorLeft );
+    engine.addAnchor( c, Qt::AnchorRight, e, Qt::AnchorLeft );
+
+    engine.addAnchor( b, Qt::AnchorRight, nullptr, Qt::AnchorRight );
+    engine.addAnchor( e, Qt::AnchorRight, nullptr, Qt::AnchorRight );
+    engine.addAnchor( d, Qt::AnchorRight, e, Qt::AnchorLeft );
+
+    engine.addAnchor( f, Qt::AnchorLeft, nullptr, Qt::AnchorLeft );
+    engine.addAnchor( g, Qt::AnchorLeft, nullptr, Qt::AnchorLeft );
+    engine.addAnchor( f, Qt::AnchorRight, g, Qt::AnchorRight );
+}
+
+void AnchorBenchmark::changeHints( int iteration )
+{
+    const qreal extent = 100 + iteration % 50;
+    m_items[2]->setPreferredSize( extent, extent );
+}
+
+void AnchorBenchmark::layout( AnchorLayoutEngine& engine, int iteration ) const
+{
+    ( void ) engine.sizeHint( Qt::PreferredSize );
+
+    const qreal extent = 400 + iteration % 200;
+    engine.setGeometries( QRectF( 0, 0, extent, extent ) );
+}
@@ -0,0 +1,36 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) 2016 Uwe Rathmann
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#pragma once
+
+#include "Benchmark.h"
+
+#include <QQuickItem>
+
+class AnchorLayoutEngine;
+class QskControl;
+
+/*
+    Comparing the time for solving the anchors of the setup1 example
+    of the anchors playground from scratch with solving them incrementally,
+    when the size hints of one item change and the layout rectangle
+    gets resized.
+ */
+class AnchorBenchmark : public Benchmark
+{
+  public:
+    AnchorBenchmark();
+
+  protected:
+    void execute() override;
+
+  private:
+    void setup( AnchorLayoutEngine& ) const;
+    void changeHints( int iteration );
+    void layout( AnchorLayoutEngine&, int iteration ) const;
+
+    QQuickItem m_parent;
+    QskControl* m_items[7];
+};
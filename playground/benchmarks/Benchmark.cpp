@@ -0,0 +1,39 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) 2016 Uwe Rathmann
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#include "Benchmark.h"
+
+#include <QDebug>
+
+Benchmark::Benchmark( const char* name )
+    : m_name( name )
+{
+}
+
+Benchmark::~Benchmark()
+{
+}
+
+const char* Benchmark::name() const
+{
+    return m_name;
+}
+
+void Benchmark::run()
+{
+    m_timer.start();
+    execute();
+}
+
+void Benchmark::report( const QByteArray& operation, int count )
+{
+    const auto ms = m_timer.restart();
+
+    auto debug = qDebug().noquote().nospace();
+
+    debug << m_name << ", " << operation << ": " << ms << "ms";
+    if ( count >= 0 )
+        debug << " for " << count << " iterations";
+}
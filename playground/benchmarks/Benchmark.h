@@ -0,0 +1,34 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) 2016 Uwe Rathmann
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#pragma once
+
+#include <QElapsedTimer>
+#include <QByteArray>
+
+/*
+    Timing operations, that are not visible in a window. run() calls
+    execute(), where the timer has been started and report() prints
+    the time, that has elapsed since the previous report.
+ */
+class Benchmark
+{
+  public:
+    Benchmark( const char* name );
+    virtual ~Benchmark();
+
+    const char* name() const;
+
+    void run();
+
+  protected:
+    virtual void execute() = 0;
+
+    void report( const QByteArray& operation, int count = -1 );
+
+  private:
+    const char* m_name;
+    QElapsedTimer m_timer;
+};
@@ -0,0 +1,92 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) 2016 Uwe Rathmann
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#include "GridBenchmark.h"
+
+static const int qskDimension = 100;
+
+GridBenchmark::GridBenchmark()
+    : Benchmark( "grid" )
+{
+    m_items.reserve( qskDimension * qskDimension );
+
+    for ( int i = 0; i < qskDimension * qskDimension; i++ )
+    {
+        auto item = new QQuickItem( &m_parent );
+        item->setImplicitSize( 20, 10 );
+
+        m_items += item;
+    }
+}
+
+void GridBenchmark::execute()
+{
+    insertItems();
+    report( "insertItem", m_items.count() );
+
+    lookupIndexes();
+    report( "indexOf", m_items.count() );
+
+    lookupCells();
+    report( "indexAt/itemAt", m_items.count() );
+
+    m_engine.setGeometries( QRectF( 0, 0, 2500, 1500 ) );
+    report( "setGeometries" );
+
+    removeItems();
+    report( "removeAt", m_items.count() );
+}
+
+void GridBenchmark::insertItems()
+{
+    for ( int i = 0; i < m_items.count(); i++ )
+    {
+        const QRect grid( i % qskDimension, i / qskDimension, 1, 1 );
+        m_engine.insertItem( m_items[i], grid );
+    }
+}
+
+void GridBenchmark::lookupIndexes() const
+{
+    int hits = 0;
+
+    for ( const auto item : m_items )
+    {
+        if ( m_engine.indexOf( item ) >= 0 )
+            hits++;
+    }
+
+    Q_ASSERT( hits == m_items.count() );
+    Q_UNUSED( hits );
+}
+
+void GridBenchmark::lookupCells() const
+{
+    int hits = 0;
+
+    for ( int row = 0; row < qskDimension; row++ )
+    {
+        for ( int col = 0; col < qskDimension; col++ )
+        {
+            const auto index = m_engine.indexAt( row, col );
+            if ( m_engine.itemAt( index ) )
+                hits++;
+        }
+    }
+
+    Q_ASSERT( hits == m_items.count() );
+    Q_UNUSED( hits );
+}
+
+void GridBenchmark::removeItems()
+{
+    // every second item first, then the remaining ones from the front
+
+    for ( int i = 0; i < m_items.count(); i += 2 )
+        m_engine.removeAt( m_engine.indexOf( m_items[i] ) );
+
+    while ( m_engine.count() > 0 )
+        m_engine.removeAt( 0 );
+}
@@ -0,0 +1,38 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) 2016 Uwe Rathmann
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#pragma once
+
+#include "Benchmark.h"
+
+#include <QskGridLayoutEngine.h>
+
+#include <QQuickItem>
+#include <QVector>
+
+/*
+    Timing the operations of QskGridLayoutEngine, that are
+    not related to calculating the layout: inserting, removing
+    and looking up elements of a grid with 10000 cells.
+ */
+class GridBenchmark : public Benchmark
+{
+  public:
+    GridBenchmark();
+
+  protected:
+    void execute() override;
+
+  private:
+    void insertItems();
+    void lookupIndexes() const;
+    void lookupCells() const;
+    void removeItems();
+
+    QQuickItem m_parent;
+    QVector< QQuickItem* > m_items;
+
+    QskGridLayoutEngine m_engine;
+};
@@ -0,0 +1,88 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) 2016 Uwe Rathmann
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#include "NodeBenchmark.h"
+
+#include <QskSGNode.h>
+#include <QskTreeNode.h>
+#include <QskSegmentedBarSkinlet.h>
+#include <QskMenuSkinlet.h>
+
+static const int qskIterations = 100000;
+
+static QVector< quint8 > qskRoles( int count )
+{
+    QVector< quint8 > roles;
+    for ( int i = 0; i < count; i++ )
+        roles += static_cast< quint8 >( i );
+
+    return roles;
+}
+
+static void qskUpdateNode( const QVector< quint8 >& roles,
+    QSGNode* parentNode, quint8 role, bool on )
+{
+    using namespace QskSGNode;
+
+    auto oldNode = findChildNode( parentNode, role );
+
+    QSGNode* newNode = nullptr;
+    if ( on )
+        newNode = oldNode ? oldNode : new QSGNode();
+
+    replaceChildNode( roles, role, parentNode, oldNode, newNode );
+}
+
+NodeBenchmark::NodeBenchmark()
+    : Benchmark( "nodes" )
+{
+}
+
+void NodeBenchmark::execute()
+{
+    const struct
+    {
+        const char* className;
+        QVector< quint8 > roles;
+    } controls[] =
+    {
+        { "QskSegmentedBar", qskRoles( QskSegmentedBarSkinlet::RoleCount ) },
+        { "QskMenu", qskRoles( QskMenuSkinlet::RoleCount ) }
+    };
+
+    for ( const auto& control : controls )
+    {
+        const QByteArray className( control.className );
+
+        {
+            QSGNode node;
+            updateNodes( control.roles, &node );
+            report( className + "/QSGNode", qskIterations );
+        }
+
+        {
+            QskTreeNode node;
+            updateNodes( control.roles, &node );
+            report( className + "/QskTreeNode", qskIterations );
+        }
+    }
+}
+
+void NodeBenchmark::updateNodes(
+    const QVector< quint8 >& roles, QSGNode* parentNode )
+{
+    for ( int i = 0; i < qskIterations; i++ )
+    {
+        qskUpdateNode( roles, parentNode, QskSGNode::BackgroundRole, true );
+        qskUpdateNode( roles, parentNode, QskSGNode::DebugRole, false );
+
+        for ( const auto role : roles )
+        {
+            // the last role appears/disappears, like a splash or cursor
+            const bool on = ( role != roles.last() ) || ( i % 2 );
+            qskUpdateNode( roles, parentNode, role, on );
+        }
+    }
+}
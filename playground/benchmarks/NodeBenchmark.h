@@ -0,0 +1,31 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) 2016 Uwe Rathmann
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#pragma once
+
+#include "Benchmark.h"
+
+#include <QVector>
+
+class QSGNode;
+
+/*
+    Timing the lookups/replacements of child nodes, that are done
+    in QskSkinlet::updateNode, for the node roles of QskSegmentedBar
+    and QskMenu. The paint node of a control is a QskTreeNode, that
+    indexes its children by role - a plain QSGNode is the parent,
+    where the children have to be found by walking the sibling list.
+ */
+class NodeBenchmark : public Benchmark
+{
+  public:
+    NodeBenchmark();
+
+  protected:
+    void execute() override;
+
+  private:
+    void updateNodes( const QVector< quint8 >& roles, QSGNode* parentNode );
+};
@@ -0,0 +1,32 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) 2016 Uwe Rathmann
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#include "NodeBenchmark.h"
+#include "GridBenchmark.h"
+#include "AnchorBenchmark.h"
+
+#include <QGuiApplication>
+
+int main( int argc, char* argv[] )
+{
+    QGuiApplication app( argc, argv );
+
+    NodeBenchmark nodeBenchmark;
+    GridBenchmark gridBenchmark;
+    AnchorBenchmark anchorBenchmark;
+
+    Benchmark* benchmarks[] = { &nodeBenchmark, &gridBenchmark, &anchorBenchmark };
+
+    // benchmarks can be selected by name: "benchmarks nodes anchors"
+    const auto names = app.arguments().mid( 1 );
+
+    for ( auto benchmark : benchmarks )
+    {
+        if ( names.isEmpty() || names.contains( benchmark->name() ) )
+            benchmark->run();
+    }
+
+    return 0;
+}
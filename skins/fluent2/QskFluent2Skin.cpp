@@ -1932,10 +1932,10 @@ void Editor::setupVirtualKeyboardColors(
 
     setGradient( Q::ButtonPanel, pal.fillColor.control.defaultColor );
     setGradient( Q::ButtonPanel | Q::Hovered, pal.fillColor.control.secondary );
-    setGradient( Q::ButtonPanel | QskPushButton::Pressed, pal.fillColor.control.tertiary );
+    setGradient( Q::ButtonPanel | Q::Pressed, pal.fillColor.control.tertiary );
 
     setColor( Q::ButtonText, pal.fillColor.text.primary );
-    setColor( Q::ButtonText | QskPushButton::Pressed, pal.fillColor.text.secondary );
+    setColor( Q::ButtonText | Q::Pressed, pal.fillColor.text.secondary );
 
     setGradient( Q::Panel, pal.background.solid.tertiary );
 }
@@ -1096,8 +1096,8 @@ void Editor::setupVirtualKeyboard()
     // key panel
     setMargin( Q::ButtonPanel, 5_dp );
     setGradient( Q::ButtonPanel, m_pal.surface2 );
-    setGradient( Q::ButtonPanel | QskPushButton::Pressed, m_pal.surface );
-    setColor( Q::ButtonText | QskPushButton::Pressed, m_pal.outlineVariant );
+    setGradient( Q::ButtonPanel | Q::Pressed, m_pal.surface );
+    setColor( Q::ButtonText | Q::Pressed, m_pal.outlineVariant );
     setBoxShape( Q::ButtonPanel, 6_dp );
 
     setBoxShape( Q::ButtonPanel | A::Huge, 100, Qt::RelativeSize );
@@ -1113,7 +1113,7 @@ void Editor::setupVirtualKeyboard()
     setGradient( Q::ButtonPanel | A::Tiny, m_pal.outlineVariant );
 
     for ( auto state : { A::NoState, Q::Focused } )
-        setBoxBorderColors( Q::ButtonPanel | QskPushButton::Pressed | state,
+        setBoxBorderColors( Q::ButtonPanel | Q::Pressed | state,
             m_pal.secondary );
 
     setAnimation( Q::ButtonPanel | A::Color, qskDuration );
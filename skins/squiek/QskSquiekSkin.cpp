@@ -1008,12 +1008,12 @@ void Editor::setupVirtualKeyboard()
     setPanel( Q::Panel, Raised );
 
     setButton( Q::ButtonPanel, Raised );
-    setButton( Q::ButtonPanel | QskPushButton::Pressed, Sunken );
+    setButton( Q::ButtonPanel | Q::Pressed, Sunken );
 
     setAnimation( Q::ButtonPanel | A::Color, qskDuration );
 
     setColor( Q::ButtonText, m_pal.themeForeground );
-    setColor( Q::ButtonText | QskPushButton::Disabled, m_pal.darker200 );
+    setColor( Q::ButtonText | Q::Disabled, m_pal.darker200 );
 }
 
 void Editor::setupScrollView()
@@ -0,0 +1,302 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) 2016 Uwe Rathmann
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#include "QskLayoutCounter.h"
+
+#include <qdebug.h>
+#include <qmap.h>
+#include <qobject.h>
+#include <qpointer.h>
+#include <qquickwindow.h>
+#include <qvector.h>
+
+namespace
+{
+    using CounterTable = QHash< const char*, QskLayoutCounter::Statistics >;
+
+    class CounterData
+    {
+      public:
+        CounterTable frameCounters;
+        CounterTable totalCounters;
+    };
+}
+
+/*
+    Counters are registered and unregistered on the GUI thread only,
+    as they are updated from methods, that are not thread-safe anyway.
+ */
+static QVector< CounterData* > qskCounters;
+
+static inline QskLayoutCounter::StatisticsTable qskStatisticsTable(
+    const CounterTable& counterTable )
+{
+    QskLayoutCounter::StatisticsTable table;
+    table.reserve( counterTable.size() );
+
+    for ( auto it = counterTable.constBegin(); it != counterTable.constEnd(); ++it )
+        table[ QByteArray( it.key() ) ].add( it.value() );
+
+    return table;
+}
+
+static inline void qskAddTable( CounterTable& to, const CounterTable& from )
+{
+    for ( auto it = from.constBegin(); it != from.constEnd(); ++it )
+        to[ it.key() ].add( it.value() );
+}
+
+static void qskDebugTable( QDebug debug, const QskLayoutCounter::StatisticsTable& table )
+{
+    // sorted by class name
+    QMap< QByteArray, QskLayoutCounter::Statistics > map;
+    for ( auto it = table.constBegin(); it != table.constEnd(); ++it )
+        map.insert( it.key(), it.value() );
+
+    for ( auto it = map.constBegin(); it != map.constEnd(); ++it )
+        debug << ' ' << it.key().constData() << it.value();
+}
+
+class QskLayoutCounter::PrivateData
+{
+  public:
+    PrivateData( bool debugAtDestruction )
+        : debugAtDestruction( debugAtDestruction )
+    {
+    }
+
+    CounterData counterData;
+
+    CounterTable lastFrameCounters;
+    CounterTable intervalCounters;
+
+    QPointer< QQuickWindow > window;
+    QMetaObject::Connection connection;
+
+    int frameCount = 0;
+    int logInterval = 0;
+
+    const bool debugAtDestruction;
+};
+
+void QskLayoutCounter::Statistics::add( const Statistics& other )
+{
+    for ( int i = 0; i < OperationCount; i++ )
+    {
+        calls[i] += other.calls[i];
+        nsecs[i] += other.nsecs[i];
+    }
+}
+
+QskLayoutCounter::Probe::Probe( const QObject* object, Operation operation )
+    : m_object( qskCounters.isEmpty() ? nullptr : object )
+    , m_operation( operation )
+{
+    if ( m_object )
+        m_timer.start();
+}
+
+QskLayoutCounter::Probe::~Probe()
+{
+    if ( m_object == nullptr || qskCounters.isEmpty() )
+        return;
+
+    const auto nsecs = m_timer.nsecsElapsed();
+    const auto className = m_object->metaObject()->className();
+
+    for ( auto counterData : std::as_const( qskCounters ) )
+    {
+        auto& statistics = counterData->frameCounters[ className ];
+        statistics.calls[ m_operation ]++;
+        statistics.nsecs[ m_operation ] += nsecs;
+
+        auto& totalStatistics = counterData->totalCounters[ className ];
+        totalStatistics.calls[ m_operation ]++;
+        totalStatistics.nsecs[ m_operation ] += nsecs;
+    }
+}
+
+QskLayoutCounter::QskLayoutCounter( bool debugAtDestruction )
+    : m_data( new PrivateData( debugAtDestruction ) )
+{
+    setActive( true );
+}
+
+QskLayoutCounter::~QskLayoutCounter()
+{
+    setActive( false );
+    setWindow( nullptr );
+
+    if ( m_data->debugAtDestruction )
+        dump();
+}
+
+void QskLayoutCounter::setActive( bool on )
+{
+    const bool isRegistered = qskCounters.contains( &m_data->counterData );
+
+    if ( on && !isRegistered )
+        qskCounters += &m_data->counterData;
+    else if ( !on && isRegistered )
+        qskCounters.removeOne( &m_data->counterData );
+}
+
+bool QskLayoutCounter::isActive() const
+{
+    return qskCounters.contains( &m_data->counterData );
+}
+
+void QskLayoutCounter::setWindow( QQuickWindow* window )
+{
+    if ( window == m_data->window )
+        return;
+
+    if ( m_data->connection )
+        QObject::disconnect( m_data->connection );
+
+    m_data->window = window;
+
+    if ( window )
+    {
+        // afterAnimating is emitted after polishing the items
+        m_data->connection = QObject::connect( window,
+            &QQuickWindow::afterAnimating, window, [this] { endFrame(); } );
+    }
+}
+
+QQuickWindow* QskLayoutCounter::window() const
+{
+    return m_data->window;
+}
+
+void QskLayoutCounter::setLogInterval( int frames )
+{
+    m_data->logInterval = qMax( frames, 0 );
+}
+
+int QskLayoutCounter::logInterval() const
+{
+    return m_data->logInterval;
+}
+
+void QskLayoutCounter::reset()
+{
+    m_data->counterData.frameCounters.clear();
+    m_data->counterData.totalCounters.clear();
+
+    m_data->lastFrameCounters.clear();
+    m_data->intervalCounters.clear();
+
+    m_data->frameCount = 0;
+}
+
+int QskLayoutCounter::frameCount() const
+{
+    return m_data->frameCount;
+}
+
+QskLayoutCounter::StatisticsTable QskLayoutCounter::frameStatistics() const
+{
+    return qskStatisticsTable( m_data->lastFrameCounters );
+}
+
+QskLayoutCounter::StatisticsTable QskLayoutCounter::statistics() const
+{
+    return qskStatisticsTable( m_data->counterData.totalCounters );
+}
+
+void QskLayoutCounter::endFrame()
+{
+    auto& frameCounters = m_data->counterData.frameCounters;
+
+    m_data->lastFrameCounters.swap( frameCounters );
+    frameCounters.clear();
+
+    m_data->frameCount++;
+
+    const auto interval = m_data->logInterval;
+    if ( interval <= 0 )
+        return;
+
+    qskAddTable( m_data->intervalCounters, m_data->lastFrameCounters );
+
+    if ( m_data->frameCount % interval == 0 )
+    {
+        if ( !m_data->intervalCounters.isEmpty() )
+        {
+            QDebug debug = qDebug();
+
+            QDebugStateSaver saver( debug );
+            debug.nospace();
+
+            debug << "Layout[ frames " << m_data->frameCount - interval + 1
+                << '-' << m_data->frameCount << " ]:";
+
+            qskDebugTable( debug, qskStatisticsTable( m_data->intervalCounters ) );
+        }
+
+        m_data->intervalCounters.clear();
+    }
+}
+
+void QskLayoutCounter::dump() const
+{
+    QDebug debug = qDebug();
+
+    QDebugStateSaver saver( debug );
+    debug.nospace();
+
+    debug << "* Layout Statistics\n";
+    debug << "  Frames: " << m_data->frameCount << '\n';
+    debug << "  Classes:";
+
+    qskDebugTable( debug, statistics() );
+}
+
+#ifndef QT_NO_DEBUG_STREAM
+
+QDebug operator<<( QDebug debug, const QskLayoutCounter::Statistics& statistics )
+{
+    static const char* names[] = { "polish", "layout", "hint", "layoutHint" };
+
+    QDebugStateSaver saver( debug );
+    debug.nospace();
+
+    debug << '(';
+
+    bool isFirst = true;
+
+    for ( int i = 0; i < QskLayoutCounter::OperationCount; i++ )
+    {
+        if ( statistics.calls[i] == 0 )
+            continue;
+
+        if ( !isFirst )
+            debug << ", ";
+
+        debug << names[i] << ": " << statistics.calls[i]
+            << '/' << statistics.nsecs[i] / 1000 << "us";
+
+        isFirst = false;
+    }
+
+    debug << ')';
+
+    return debug;
+}
+
+QDebug operator<<( QDebug debug, const QskLayoutCounter& counter )
+{
+    QDebugStateSaver saver( debug );
+    debug.nospace();
+
+    debug << "QskLayoutCounter(";
+    qskDebugTable( debug, counter.statistics() );
+    debug << " )";
+
+    return debug;
+}
+
+#endif
@@ -0,0 +1,117 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) 2016 Uwe Rathmann
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#ifndef QSK_LAYOUT_COUNTER_H
+#define QSK_LAYOUT_COUNTER_H
+
+#include "QskGlobal.h"
+
+#include <qbytearray.h>
+#include <qelapsedtimer.h>
+#include <qhash.h>
+
+#include <memory>
+
+class QObject;
+class QQuickWindow;
+
+/*
+    Counting the calls of the layout related methods of QskControl
+    and how long they take - aggregated by class name.
+
+    As long as no counter is active the probes are reduced to checking
+    if the static list of active counters is empty. When being attached to a window the statistics are
+    separated into frames, where a frame ends with QQuickWindow::afterAnimating(),
+    that is emitted after the items have been polished.
+
+    Note, that the methods are called recursively, when a container asks
+    its children for their size hints. So the durations always include the
+    time of the nested calls.
+ */
+class QSK_EXPORT QskLayoutCounter
+{
+  public:
+    enum Operation
+    {
+        UpdateItemPolish,
+        UpdateLayout,
+        EffectiveSizeHint,
+        LayoutSizeHint
+    };
+
+    enum
+    {
+        OperationCount = LayoutSizeHint + 1
+    };
+
+    class Statistics
+    {
+      public:
+        void add( const Statistics& );
+
+        int calls[ OperationCount ] = {};
+        qint64 nsecs[ OperationCount ] = {};
+    };
+
+    using StatisticsTable = QHash< QByteArray, Statistics >;
+
+    class QSK_EXPORT Probe
+    {
+      public:
+        Probe( const QObject*, Operation );
+        ~Probe();
+
+      private:
+        Q_DISABLE_COPY( Probe )
+
+        const QObject* m_object;
+        const Operation m_operation;
+        QElapsedTimer m_timer;
+    };
+
+    QskLayoutCounter( bool debugAtDestruction = false );
+    ~QskLayoutCounter();
+
+    void setActive( bool );
+    bool isActive() const;
+
+    void setWindow( QQuickWindow* );
+    QQuickWindow* window() const;
+
+    // a log line for every n frames, 0 disables logging
+    void setLogInterval( int frames );
+    int logInterval() const;
+
+    void reset();
+
+    int frameCount() const;
+
+    // the statistics of the last completed frame
+    StatisticsTable frameStatistics() const;
+
+    // the statistics since the last reset
+    StatisticsTable statistics() const;
+
+    void dump() const;
+
+  private:
+    Q_DISABLE_COPY( QskLayoutCounter )
+
+    void endFrame();
+
+    class PrivateData;
+    std::unique_ptr< PrivateData > m_data;
+};
+
+#ifndef QT_NO_DEBUG_STREAM
+
+class QDebug;
+
+QSK_EXPORT QDebug operator<<( QDebug, const QskLayoutCounter::Statistics& );
+QSK_EXPORT QDebug operator<<( QDebug, const QskLayoutCounter& );
+
+#endif
+
+#endif
@@ -8,6 +8,7 @@
 
 #include "QskAspect.h"
 #include "QskFunctions.h"
+#include "QskLayoutCounter.h"
 #include "QskEvent.h"
 #include "QskQuick.h"
 #include "QskSetup.h"
@@ -666,6 +667,8 @@ QSizeF QskControl::effectiveSizeHint(
     if ( constraint.isValid() )
         return constraint;
 
+    const QskLayoutCounter::Probe probe( this, QskLayoutCounter::EffectiveSizeHint );
+
     const bool isConstrained =
         constraint.width() >= 0 || constraint.height() >= 0;
 
@@ -764,16 +767,28 @@ bool QskControl::event( QEvent* event )
     {
         case QEvent::EnabledChange:
         {
+            markNodesDirty();
             setSkinStateFlag( Disabled, !isEnabled() );
             break;
         }
         case QEvent::LocaleChange:
         {
+            markNodesDirty();
             Q_EMIT localeChanged( locale() );
             break;
         }
+        case QEvent::FontChange:
+        case QEvent::PaletteChange:
+        case QEvent::ReadOnlyChange:
+        case QEvent::LayoutDirectionChange:
+        {
+            // QskQuickItem::event schedules an update
+            markNodesDirty();
+            break;
+        }
         case QEvent::ContentsRectChange:
         {
+            markNodesDirty();
             resetImplicitSize();
             if ( d_func()->autoLayoutChildren )
                 polish();
@@ -782,6 +797,12 @@ bool QskControl::event( QEvent* event )
         }
         case QEvent::LayoutRequest:
         {
+            /*
+                The hints might depend on the children, even without
+                autoLayoutChildren - f.e. the clip item of QskScrollArea
+             */
+            d_func()->invalidateSizeHints();
+
             if ( d_func()->autoLayoutChildren )
             {
                 resetImplicitSize();
@@ -941,9 +962,11 @@ void QskControl::itemChange( QQuickItem::ItemChange change,
 void QskControl::geometryChange(
     const QRectF& newGeometry, const QRectF& oldGeometry )
 {
-    if ( d_func()->autoLayoutChildren )
+    if ( newGeometry.size() != oldGeometry.size() )
     {
-        if ( newGeometry.size() != oldGeometry.size() )
+        markNodesDirty();
+
+        if ( d_func()->autoLayoutChildren )
             polish();
     }
 
@@ -952,6 +975,8 @@ void QskControl::geometryChange(
 
 void QskControl::updateItemPolish()
 {
+    const QskLayoutCounter::Probe probe( this, QskLayoutCounter::UpdateItemPolish );
+
     updateResources(); // an extra dirty bit for this ???
 
     if ( width() >= 0.0 || height() >= 0.0 )
@@ -971,6 +996,7 @@ void QskControl::updateItemPolish()
             }
         }
 
+        const QskLayoutCounter::Probe layoutProbe( this, QskLayoutCounter::UpdateLayout );
         updateLayout();
     }
 }
@@ -978,7 +1004,10 @@ void QskControl::updateItemPolish()
 QSGNode* QskControl::updateItemPaintNode( QSGNode* node )
 {
     if ( node == nullptr )
+    {
         node = new QskTreeNode();
+        markNodesDirty();
+    }
 
     updateNode( node );
     return node;
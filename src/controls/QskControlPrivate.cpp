@@ -5,6 +5,7 @@
 
 #include "QskControlPrivate.h"
 #include "QskSetup.h"
+#include "QskLayoutCounter.h"
 #include "QskLayoutMetrics.h"
 #include "QskObjectTree.h"
 #include "QskWindow.h"
@@ -141,8 +142,45 @@ void qskInheritSection( QskControl* control, QskAspect::Section section )
     custom controls in QML.
  */
 
+class QskControlPrivate::SizeHintCache
+{
+  public:
+    SizeHintCache()
+    {
+        invalidate();
+    }
+
+    inline void invalidate()
+    {
+        for ( auto& isValid : isValidHint )
+            isValid = false;
+
+        for ( auto& entry : constrainedHints )
+            entry.which = -1;
+    }
+
+    // Qt::MinimumSize, Qt::PreferredSize, Qt::MaximumSize
+    bool isValidHint[ Qt::MaximumSize + 1 ];
+    QSizeF hints[ Qt::MaximumSize + 1 ];
+
+    /*
+        Layouts often ask for the same constrained hints several
+        times, f.e. heightForWidth for the same width. So we store the
+        most recent ones - replaced in round robin order.
+     */
+    struct
+    {
+        int which;
+        QSizeF constraint;
+        QSizeF hint;
+    } constrainedHints[4];
+
+    int nextConstrainedHint = 0;
+};
+
 QskControlPrivate::QskControlPrivate()
     : explicitSizeHints( nullptr )
+    , sizeHintCache( nullptr )
     , sizePolicy( QskSizePolicy::Preferred, QskSizePolicy::Preferred )
     , visiblePlacementPolicy( 0 )
     , hiddenPlacementPolicy( 0 )
@@ -159,10 +197,18 @@ QskControlPrivate::QskControlPrivate()
 QskControlPrivate::~QskControlPrivate()
 {
     delete [] explicitSizeHints;
+    delete sizeHintCache;
 }
 
 void QskControlPrivate::layoutConstraintChanged()
 {
+    /*
+        Whatever has changed might also affect the hints. Calling
+        invalidateSizeHints here covers the layout relevant setters,
+        that don't go through resetImplicitSize().
+     */
+    invalidateSizeHints();
+
     if ( !blockLayoutRequestEvents )
     {
         Inherited::layoutConstraintChanged();
@@ -189,8 +235,57 @@ QSizeF QskControlPrivate::implicitSizeHint() const
     return implicitSizeHint( Qt::PreferredSize, QSizeF() );
 }
 
+void QskControlPrivate::invalidateSizeHints()
+{
+    if ( sizeHintCache )
+        sizeHintCache->invalidate();
+}
+
 QSizeF QskControlPrivate::implicitSizeHint(
     Qt::SizeHint which, const QSizeF& constraint ) const
+{
+    if ( which < Qt::MinimumSize || which > Qt::MaximumSize )
+    {
+        // Qt::MinimumDescent is not cached
+        return calculatedSizeHint( which, constraint );
+    }
+
+    if ( sizeHintCache == nullptr )
+        sizeHintCache = new SizeHintCache();
+
+    auto cache = sizeHintCache;
+
+    if ( constraint.width() < 0.0 && constraint.height() < 0.0 )
+    {
+        if ( !cache->isValidHint[ which ] )
+        {
+            cache->hints[ which ] = calculatedSizeHint( which, constraint );
+            cache->isValidHint[ which ] = true;
+        }
+
+        return cache->hints[ which ];
+    }
+
+    for ( const auto& entry : cache->constrainedHints )
+    {
+        if ( entry.which == which && entry.constraint == constraint )
+            return entry.hint;
+    }
+
+    const auto hint = calculatedSizeHint( which, constraint );
+
+    auto& entry = cache->constrainedHints[ cache->nextConstrainedHint ];
+    entry.which = which;
+    entry.constraint = constraint;
+    entry.hint = hint;
+
+    cache->nextConstrainedHint = ( cache->nextConstrainedHint + 1 ) % 4;
+
+    return hint;
+}
+
+QSizeF QskControlPrivate::calculatedSizeHint(
+    Qt::SizeHint which, const QSizeF& constraint ) const
 {
     Q_Q( const QskControl );
 
@@ -225,6 +320,8 @@ QSizeF QskControlPrivate::implicitSizeHint(
 
     QSizeF layoutHint;
     {
+        const QskLayoutCounter::Probe probe( q, QskLayoutCounter::LayoutSizeHint );
+
         if ( constraint.width() >= 0.0 )
         {
             const QSizeF boundingSize( constraint.width(), 1e6 );
@@ -33,8 +33,11 @@ class QskControlPrivate : public QskQuickItemPrivate
     QSizeF implicitSizeHint( Qt::SizeHint, const QSizeF& ) const;
     QSizeF implicitSizeHint() const override final;
 
+    QSizeF calculatedSizeHint( Qt::SizeHint, const QSizeF& ) const;
+
     void implicitSizeChanged() override final;
     void layoutConstraintChanged() override final;
+    void invalidateSizeHints() override final;
 
     QskPlacementPolicy::Policy placementPolicy( bool visible ) const noexcept;
     void setPlacementPolicy( bool visible, QskPlacementPolicy::Policy );
@@ -44,6 +47,10 @@ class QskControlPrivate : public QskQuickItemPrivate
 
     QSizeF* explicitSizeHints;
 
+    // implicit hints, valid until the next resetImplicitSize
+    class SizeHintCache;
+    mutable SizeHintCache* sizeHintCache;
+
     QLocale locale;
 
     QskSizePolicy sizePolicy;
@@ -4,7 +4,7 @@
  *****************************************************************************/
 
 #include "QskDirtyItemFilter.h"
-#include "QskQuickItem.h"
+#include "QskControl.h"
 
 QSK_QT_PRIVATE_BEGIN
 #include <private/qquickitem_p.h>
@@ -19,24 +19,127 @@ static inline bool qskIsUpdateBlocked( const QQuickItem* item )
             return qskItem->testUpdateFlag( QskQuickItem::DeferredUpdate );
     }
 
-#if 0
+    return false;
+}
+
+static inline bool qskIsOffWindowCandidate( const QQuickItem* item )
+{
+    auto qskItem = qobject_cast< const QskQuickItem* >( item );
+    if ( qskItem == nullptr || !qskItem->testUpdateFlag( QskQuickItem::DeferredUpdate ) )
+        return false;
+
+    if ( !item->isVisible() )
+        return false;
+
     /*
-        Blocking items, that are outside the window would be easy,
-        but we have not yet found a performant way to send update notifications
-        when an item enters/leaves the window. TODO ...
+        Only items, where nothing else than the paint node is affected
+        can be blocked. Otherwise the transform or clip nodes of the child
+        items - that might be inside the window - would be outdated.
      */
-    else if ( const auto control = qskControlCast( item ) )
+    int dirtyMask = QQuickItemPrivate::Content
+        | QQuickItemPrivate::Smooth | QQuickItemPrivate::Antialiasing;
+
+    if ( !item->clip() )
+        dirtyMask |= QQuickItemPrivate::Size;
+
+    const auto d = QQuickItemPrivate::get( item );
+    if ( d->dirtyAttributes & ~dirtyMask )
+        return false;
+
+    for ( auto it = item; it != nullptr; it = it->parentItem() )
     {
-        const QRectF itemRect( item->mapToScene( QPointF() ), item->size() );
-        const QRectF sceneRect( 0, 0, item->window()->width(), item->window()->height() );
+        /*
+            Items being the source of a QQuickShaderEffectSource might be
+            displayed somewhere else. Layers are displayed at the position of
+            the item, but we don't want to deal with them either.
+         */
+        const auto dd = QQuickItemPrivate::get( it );
+        if ( dd->extra.isAllocated() && ( dd->extra->effectRefCount > 0 ) )
+            return false;
+    }
+
+    return true;
+}
+
+static inline bool qskIsOffWindow( const QQuickItem* item )
+{
+    const auto window = item->window();
+    if ( window == nullptr )
+        return false;
 
-        return !itemRect.intersects( sceneRect );
+    /*
+        Skinlets might create nodes beyond the geometry of the item:
+        f.e. shadows. So we add some tolerance.
+     */
+    const qreal margin = 50.0;
+
+    const auto r = item->mapRectToScene(
+        QRectF( 0.0, 0.0, item->width(), item->height() ) );
+
+    return ( r.right() < -margin ) || ( r.left() > window->width() + margin )
+        || ( r.bottom() < -margin ) || ( r.top() > window->height() + margin );
+}
+
+static inline bool qskHasGeometryChanges( QQuickWindow* window )
+{
+    const int mask = QQuickItemPrivate::TransformOrigin
+        | QQuickItemPrivate::Transform | QQuickItemPrivate::BasicTransform
+        | QQuickItemPrivate::Position | QQuickItemPrivate::Size
+        | QQuickItemPrivate::ParentChanged | QQuickItemPrivate::Visible;
+
+    const auto d = QQuickWindowPrivate::get( window );
+    for ( auto item = d->dirtyItemList; item != nullptr; )
+    {
+        const auto dd = QQuickItemPrivate::get( item );
+        if ( dd->dirtyAttributes & mask )
+            return true;
+
+        item = dd->nextDirtyItem;
     }
-#endif
 
     return false;
 }
 
+static inline void qskAddToDirtyList( QQuickItem* item )
+{
+    /*
+        QQuickItemPrivate::addToDirtyList also schedules another frame,
+        what is pointless as we are about to synchronize anyway.
+     */
+    auto d = QQuickItemPrivate::get( item );
+    auto wd = QQuickWindowPrivate::get( item->window() );
+
+    d->nextDirtyItem = wd->dirtyItemList;
+    if ( d->nextDirtyItem )
+        QQuickItemPrivate::get( d->nextDirtyItem )->prevDirtyItem = &d->nextDirtyItem;
+
+    d->prevDirtyItem = &wd->dirtyItemList;
+    wd->dirtyItemList = item;
+}
+
+static inline void qskMarkNodesDirty( QQuickWindow* window )
+{
+    /*
+        QskSkinnable::markSubcontrolDirty schedules updates, that are
+        limited to the nodes of some subcontrols, without setting the
+        Content flag. So when having the flag the update has also been
+        requested for other reasons and all nodes need to be updated.
+     */
+    const auto d = QQuickWindowPrivate::get( window );
+    for ( auto item = d->dirtyItemList; item != nullptr; )
+    {
+        const auto dd = QQuickItemPrivate::get( item );
+
+        if ( dd->dirtyAttributes & QQuickItemPrivate::Content )
+        {
+            if ( auto control = qskControlCast( item ) )
+                control->markNodesDirty();
+        }
+
+        item = dd->nextDirtyItem;
+    }
+}
+
 static inline void qskBlockDirty( QQuickItem* item, bool on )
 {
     if ( qskIsUpdateBlocked( item ) )
@@ -81,7 +184,7 @@ void QskDirtyItemFilter::addWindow( QQuickWindow* window )
     if ( m_windows.contains( window ) )
         return;
 
-    m_windows.insert( window );
+    m_windows.insert( window, WindowData() );
 
     /*
         Depending on the configration the scene graph runs on
@@ -105,6 +208,29 @@ void QskDirtyItemFilter::beforeSynchronizing( QQuickWindow* window )
 {
     filterDirtyList( window, qskIsUpdateBlocked );
 
+    auto it = m_windows.find( window );
+    if ( it != m_windows.end() )
+    {
+        auto& data = it.value();
+
+        /*
+            Items enter the window only when the window has been resized
+            or when items have been moved: f.e. when scrolling. Then
+            the blocked items have to be checked again.
+         */
+        const bool hasMoved = ( window->size() != data.size )
+            || qskHasGeometryChanges( window );
+
+        data.size = window->size();
+
+        if ( hasMoved )
+            flushOffWindowItems( window, data );
+
+        blockOffWindowItems( window, data );
+    }
+
+    qskMarkNodesDirty( window );
+
     if ( QQuickWindowPrivate::get( window )->renderer == nullptr )
     {
         /*
@@ -120,6 +246,76 @@ void QskDirtyItemFilter::beforeSynchronizing( QQuickWindow* window )
     }
 }
 
+void QskDirtyItemFilter::blockOffWindowItems(
+    QQuickWindow* window, WindowData& data )
+{
+    auto& items = data.offWindowItems;
+
+    auto d = QQuickWindowPrivate::get( window );
+    for ( auto item = d->dirtyItemList; item != nullptr; )
+    {
+        auto dd = QQuickItemPrivate::get( item );
+        auto nextItem = dd->nextDirtyItem;
+
+        if ( qskIsOffWindowCandidate( item ) && qskIsOffWindow( item ) )
+        {
+            /*
+                The dirty attributes are not touched, so that
+                the item can be flushed later.
+             */
+            dd->removeFromDirtyList();
+
+            auto& entry = items[ item ];
+            if ( entry.isNull() )
+                entry = item;
+        }
+        else if ( !items.isEmpty() )
+        {
+            items.remove( item );
+        }
+
+        item = nextItem;
+    }
+}
+
+void QskDirtyItemFilter::flushOffWindowItems(
+    QQuickWindow* window, WindowData& data )
+{
+    auto& items = data.offWindowItems;
+
+    for ( auto it = items.begin(); it != items.end(); )
+    {
+        auto item = it.value().data();
+
+        if ( item && item->window() == window && item->isVisible() )
+        {
+            auto d = QQuickItemPrivate::get( item );
+
+            if ( d->prevDirtyItem || d->dirtyAttributes == 0 )
+            {
+                // updated in the meantime
+                it = items.erase( it );
+                continue;
+            }
+
+            if ( qskIsOffWindow( item ) )
+            {
+                ++it;
+                continue;
+            }
+
+            qskAddToDirtyList( item );
+        }
+
+        /*
+            Invisible items are updated by QskQuickItem, when becoming
+            visible again, and items that have been moved to another window
+            are dirty there anyway.
+         */
+        it = items.erase( it );
+    }
+}
+
 void QskDirtyItemFilter::filterDirtyList(
     QQuickWindow* window, bool ( *isBlocked )( const QQuickItem* ) )
 {
@@ -8,8 +8,10 @@
 
 #include "QskGlobal.h"
 
+#include <qhash.h>
 #include <qobject.h>
-#include <qset.h>
+#include <qpointer.h>
+#include <qsize.h>
 
 class QQuickWindow;
 class QQuickItem;
@@ -28,9 +30,21 @@ class QskDirtyItemFilter : public QObject
         bool ( *isBlocked )( const QQuickItem* ) );
 
   private:
+    class WindowData
+    {
+      public:
+        QSize size;
+
+        // items with pending updates, that have been blocked for being off-window
+        QHash< const QQuickItem*, QPointer< QQuickItem > > offWindowItems;
+    };
+
     void beforeSynchronizing( QQuickWindow* );
 
-    QSet< QObject* > m_windows;
+    void blockOffWindowItems( QQuickWindow*, WindowData& );
+    void flushOffWindowItems( QQuickWindow*, WindowData& );
+
+    QHash< const QObject*, WindowData > m_windows;
 };
 
 #endif
@@ -272,6 +272,19 @@ QskAnimatorEvent* QskAnimatorEvent::clone() const
     return new QskAnimatorEvent( *this );
 }
 
+// -- QskLayoutRequestEvent
+
+QskLayoutRequestEvent::QskLayoutRequestEvent( const QQuickItem* item )
+    : QskEvent( QskEvent::ItemLayoutRequest )
+    , m_item( item )
+{
+}
+
+QskLayoutRequestEvent* QskLayoutRequestEvent::clone() const
+{
+    return new QskLayoutRequestEvent( *this );
+}
+
 // -- QskGestureFilterEvent
 
 QskGestureFilterEvent::QskGestureFilterEvent(
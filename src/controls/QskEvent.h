@@ -51,6 +51,12 @@ class QSK_EXPORT QskEvent : public QEvent
 
         Animator,
 
+        /*
+            A child item has changed its layout relevant information.
+            Receivers, that don't handle it, get a QEvent::LayoutRequest
+         */
+        ItemLayoutRequest,
+
         MaxEvent = NoEvent + 50
     };
 
@@ -158,6 +164,27 @@ class QSK_EXPORT QskGestureEvent : public QskEvent
     std::shared_ptr< const QskGesture > m_gesture;
 };
 
+/*
+    A layout request, that knows the child item, whose layout
+    relevant information has changed. Layouts can limit
+    their updates to the cached values of this item.
+ */
+class QSK_EXPORT QskLayoutRequestEvent : public QskEvent
+{
+  public:
+    QskLayoutRequestEvent( const QQuickItem* );
+
+    inline const QQuickItem* item() const { return m_item; }
+
+    QskLayoutRequestEvent* clone() const override;
+
+  protected:
+    QSK_EVENT_DISABLE_COPY( QskLayoutRequestEvent )
+
+  private:
+    const QQuickItem* m_item;
+};
+
 class QSK_EXPORT QskAnimatorEvent : public QskEvent
 {
   public:
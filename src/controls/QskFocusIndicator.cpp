@@ -15,6 +15,7 @@
 
 QSK_QT_PRIVATE_BEGIN
 #include <private/qquickitem_p.h>
+#include <private/qquickwindow_p.h>
 QSK_QT_PRIVATE_END
 
 QSK_SUBCONTROL( QskFocusIndicator, Panel )
@@ -46,6 +47,26 @@ static inline QRectF qskFocusIndicatorClipRect( const QQuickItem* item )
     return rect;
 }
 
+static inline QQuickItem* qskClippingItem( const QQuickItem* item )
+{
+    for ( auto it = item->parentItem(); it; it = it->parentItem() )
+    {
+        if ( it->clip() )
+            return it;
+    }
+
+    return nullptr;
+}
+
+static inline bool qskHasDirtyItems( QQuickWindow* window )
+{
+    /*
+        Any item, that has been moved, resized or updated since
+        the last frame, is in the dirty list of the window.
+     */
+    return window && QQuickWindowPrivate::get( window )->dirtyItemList;
+}
+
 static inline QskAspect::Section qskItemSection( const QQuickItem* item )
 {
     if ( auto control = qskControlCast( item ) )
@@ -63,19 +84,17 @@ static inline bool qskIsEnablingKey( const QKeyEvent* event )
 class QskFocusIndicator::PrivateData
 {
   public:
-    void resetConnections()
-    {
-        for ( const auto& connection : std::as_const( connections ) )
-            QObject::disconnect( connection );
-
-        connections.clear();
-    }
-
     inline bool isAutoDisabling() const { return duration > 0; }
     inline bool isAutoEnabling() const { return false; }
     
     QPointer< QQuickItem > clippingItem;
-    QVector< QMetaObject::Connection > connections;
+    QMetaObject::Connection focusItemConnection;
+
+    // the geometry, that has been calculated for the last frame
+    QRectF rect;
+    QRectF clipRect;
+
+    bool isDirty = false;
 
     int duration = 0;
     QBasicTimer timer;
@@ -281,23 +300,30 @@ QRectF QskFocusIndicator::clipRect() const
 
 void QskFocusIndicator::onFocusItemGeometryChanged()
 {
-    updateFocusFrame();
-}
+    // the geometry is updated, when preparing the next frame
+    m_data->isDirty = true;
 
-void QskFocusIndicator::onWindowSizeChanged( int )
-{
-    updateFocusFrame();
+    if ( auto w = window() )
+        w->update();
 }
 
-void QskFocusIndicator::onFocusItemDestroyed()
+void QskFocusIndicator::onAfterAnimating()
 {
-    m_data->resetConnections();
-    setVisible( false );
+    /*
+        Called once per frame, when all items have been polished, but
+        before the scene graph is synchronized. Instead of connecting to
+        the geometry notifications of the focus item and all of its ancestors
+        we map the rectangle from the scene transformations - but only
+        when something has changed since the previous frame.
+     */
+    if ( m_data->isDirty || qskHasDirtyItems( window() ) )
+        updateFocusFrame();
 }
 
 void QskFocusIndicator::onFocusItemChanged()
 {
-    m_data->resetConnections();
+    QObject::disconnect( m_data->focusItemConnection );
+    m_data->focusItemConnection = QMetaObject::Connection();
 
     if ( !( window() && window()->contentItem() ) )
         return;
@@ -307,34 +333,47 @@ void QskFocusIndicator::onFocusItemChanged()
     setZ( 10e-6 );
 
     const auto focusItem = window()->activeFocusItem();
-    QQuickItem* clippingItem = nullptr;
 
     if ( focusItem && ( focusItem != window()->contentItem() ) )
     {
         setSection( qskItemSection( focusItem ) );
 
-        auto item = focusItem;
-        m_data->connections += connectItem( item );
+        const auto method = &QskFocusIndicator::onFocusItemGeometryChanged;
 
-        while ( auto itemParent = item->parentItem() )
+        if ( const auto control = qskControlCast( focusItem ) )
         {
-            m_data->connections += connectItem( itemParent );
-
-            if ( clippingItem == nullptr && itemParent->clip() )
-                clippingItem = itemParent;
-
-            item = itemParent;
+            m_data->focusItemConnection = QObject::connect( control,
+                &QskControl::focusIndicatorRectChanged, this, method );
+        }
+        else
+        {
+            if ( focusItem->metaObject()->indexOfSignal( "focusIndicatorRectChanged()" ) >= 0 )
+            {
+                m_data->focusItemConnection = QObject::connect( focusItem,
+                    SIGNAL(focusIndicatorRectChanged()), this, SLOT(onFocusItemGeometryChanged()) );
+            }
         }
     }
 
-    m_data->clippingItem = clippingItem;
     updateFocusFrame();
 }
 
 void QskFocusIndicator::updateFocusFrame()
 {
+    m_data->isDirty = false;
+
+    QQuickItem* clippingItem = nullptr;
+
+    if ( auto w = window() )
+    {
+        const auto focusItem = w->activeFocusItem();
+        if ( focusItem && ( focusItem != w->contentItem() ) )
+            clippingItem = qskClippingItem( focusItem );
+    }
+
+    m_data->clippingItem = clippingItem;
+
     QRectF r = focusRect();
-    setVisible( !r.isEmpty() );
 
     if ( !r.isEmpty() )
     {
@@ -347,26 +386,46 @@ void QskFocusIndicator::updateFocusFrame()
 
             r = r.intersected( clipRect );
         }
+    }
+
+    /*
+        Only when something has changed: otherwise we would put
+        ourself into the dirty list, running into an endless sequence
+        of frames.
+     */
+    const bool isModified = ( r != m_data->rect ) || ( r.isEmpty() == isVisible() );
 
+    setVisible( !r.isEmpty() );
+
+    if ( !r.isEmpty() )
+    {
         setGeometry( r );
 
-        const auto clipRect = qskFocusIndicatorClipRect( m_data->clippingItem );
+        const auto clipRect = qskFocusIndicatorClipRect( clippingItem );
         setClip( !clipRect.isEmpty() );
 
         if ( clip() )
         {
-            /*
-                The clip node is updated on QQuickItemPrivate::Size
-                So we need to set it here even in situations, where
-                the size did not change. For now we always trigger an
-                update of the clipNode, but we could limit it to
-                changes of the clipRect(). TODO ...
-             */
-            QQuickItemPrivate::get( this )->dirty( QQuickItemPrivate::Size );
+            const auto rect = this->clipRect();
+
+            if ( isModified || rect != m_data->clipRect )
+            {
+                /*
+                    The clip node is updated on QQuickItemPrivate::Size
+                    So we need to set it here even in situations, where
+                    the size did not change.
+                 */
+                QQuickItemPrivate::get( this )->dirty( QQuickItemPrivate::Size );
+                m_data->clipRect = rect;
+            }
         }
     }
 
-    update();
+    if ( isModified )
+    {
+        m_data->rect = r;
+        update();
+    }
 }
 
 QRectF QskFocusIndicator::focusRect() const
@@ -418,55 +477,17 @@ void QskFocusIndicator::connectWindow( const QQuickWindow* window, bool on )
         connect( window, &QQuickWindow::activeFocusItemChanged,
             this, &QskFocusIndicator::onFocusItemChanged );
 
-        connect( window, &QQuickWindow::widthChanged,
-            this, &QskFocusIndicator::onWindowSizeChanged );
-
-        connect( window, &QQuickWindow::heightChanged,
-            this, &QskFocusIndicator::onWindowSizeChanged );
+        connect( window, &QQuickWindow::afterAnimating,
+            this, &QskFocusIndicator::onAfterAnimating );
     }
     else
     {
         disconnect( window, &QQuickWindow::activeFocusItemChanged,
             this, &QskFocusIndicator::onFocusItemChanged );
 
-        disconnect( window, &QQuickWindow::widthChanged,
-            this, &QskFocusIndicator::onWindowSizeChanged );
-
-        disconnect( window, &QQuickWindow::heightChanged,
-            this, &QskFocusIndicator::onWindowSizeChanged );
-    }
-}
-
-QVector< QMetaObject::Connection > QskFocusIndicator::connectItem( const QQuickItem* sender )
-{
-    QVector< QMetaObject::Connection > c;
-    c.reserve( 7 );
-
-    c += QObject::connect( sender, &QObject::destroyed,
-        this, &QskFocusIndicator::onFocusItemDestroyed );
-
-    const auto method = &QskFocusIndicator::onFocusItemGeometryChanged;
-
-    c += QObject::connect( sender, &QQuickItem::xChanged, this, method );
-    c += QObject::connect( sender, &QQuickItem::yChanged, this, method );
-    c += QObject::connect( sender, &QQuickItem::widthChanged, this, method );
-    c += QObject::connect( sender, &QQuickItem::heightChanged, this, method );
-    c += QObject::connect( sender, &QQuickItem::visibleChanged, this, method );
-
-    if ( const auto control = qskControlCast( sender ) )
-    {
-        c += QObject::connect( control, &QskControl::focusIndicatorRectChanged, this, method );
-    }
-    else
-    {
-        if ( sender->metaObject()->indexOfSignal( "focusIndicatorRectChanged()" ) >= 0 )
-        {
-            c += QObject::connect( sender, SIGNAL(focusIndicatorRectChanged()),
-                this, SLOT(onFocusItemGeometryChanged()) );
-        }
+        disconnect( window, &QQuickWindow::afterAnimating,
+            this, &QskFocusIndicator::onAfterAnimating );
     }
-
-    return c;
 }
 
 #include "moc_QskFocusIndicator.cpp"
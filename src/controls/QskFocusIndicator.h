@@ -47,16 +47,13 @@ class QSK_EXPORT QskFocusIndicator : public QskControl
 
   private:
     void onFocusItemGeometryChanged();
-    void onWindowSizeChanged( int );
-
     void onFocusItemChanged();
-    void onFocusItemDestroyed();
+    void onAfterAnimating();
 
     void resetTimer();
     void maybeEnable( bool );
 
     void connectWindow( const QQuickWindow*, bool on );
-    QVector< QMetaObject::Connection > connectItem( const QQuickItem* );
 
     class PrivateData;
     std::unique_ptr< PrivateData > m_data;
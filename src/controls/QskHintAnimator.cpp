@@ -147,28 +147,46 @@ void QskHintAnimator::advance( qreal progress )
 
     if ( m_control && ( currentValue() != oldValue ) )
     {
+        /*
+            As long as the geometry is not affected only the nodes
+            depending on the animated subcontrol need to be updated
+         */
+
         if ( m_updateFlags == QskAnimationHint::UpdateAuto )
         {
-            if ( !m_aspect.isColor() )
+            if ( m_aspect.isColor() )
+            {
+                m_control->markSubcontrolDirty( m_aspect.subControl() );
+            }
+            else
             {
                 m_control->resetImplicitSize();
 
                 if ( !m_control->childItems().isEmpty() )
                     m_control->polish();
-            }
 
-            m_control->update();
+                m_control->update();
+            }
         }
         else
         {
-            if ( m_updateFlags & QskAnimationHint::UpdateSizeHint )
+            using A = QskAnimationHint;
+
+            if ( m_updateFlags & A::UpdateSizeHint )
                 m_control->resetImplicitSize();
 
-            if ( m_updateFlags & QskAnimationHint::UpdatePolish )
+            if ( m_updateFlags & A::UpdatePolish )
                 m_control->polish();
 
-            if ( m_updateFlags & QskAnimationHint::UpdateNode )
-                m_control->update();
+            if ( m_updateFlags & A::UpdateNode )
+            {
+                if ( m_updateFlags & ( A::UpdateSizeHint | A::UpdatePolish ) )
+                    m_control->update();
+                else if ( m_aspect.isColor() )
+                    m_control->markSubcontrolDirty( m_aspect.subControl() );
+                else
+                    m_control->markSubcontrolDirty( QskAspect::NoSubcontrol );
+            }
         }
     }
 }
@@ -0,0 +1,371 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) 2016 Uwe Rathmann
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#include "QskItemModelListView.h"
+#include "QskEvent.h"
+
+#include <qabstractitemmodel.h>
+#include <qpointer.h>
+#include <qvector.h>
+
+class QskItemModelListView::PrivateData
+{
+  public:
+    QPointer< QAbstractItemModel > model;
+    QVector< QMetaObject::Connection > connections;
+
+    QPersistentModelIndex selectedIndex;
+    QVector< qreal > columnWidthHints;
+
+    int role = Qt::DisplayRole;
+
+    bool isFetching = false;
+};
+
+QskItemModelListView::QskItemModelListView( QQuickItem* parent )
+    : QskItemModelListView( nullptr, parent )
+{
+}
+
+QskItemModelListView::QskItemModelListView(
+        QAbstractItemModel* model, QQuickItem* parent )
+    : Inherited( parent )
+    , m_data( new PrivateData() )
+{
+    connect( this, &Inherited::selectedRowChanged, this,
+        [ this ]( int row )
+        {
+            if ( m_data->model && row >= 0 )
+                m_data->selectedIndex = m_data->model->index( row, 0 );
+            else
+                m_data->selectedIndex = QPersistentModelIndex();
+        }
+    );
+
+    connect( this, &QskScrollView::scrollPosChanged,
+        this, &QskItemModelListView::fetchMore );
+
+    setModel( model );
+}
+
+QskItemModelListView::~QskItemModelListView()
+{
+    for ( const auto& connection : std::as_const( m_data->connections ) )
+        disconnect( connection );
+}
+
+void QskItemModelListView::setModel( QAbstractItemModel* model )
+{
+    if ( model == m_data->model )
+        return;
+
+    for ( const auto& connection : std::as_const( m_data->connections ) )
+        disconnect( connection );
+
+    m_data->connections.clear();
+
+    m_data->model = model;
+    m_data->selectedIndex = QPersistentModelIndex();
+
+    if ( model )
+    {
+        using M = QAbstractItemModel;
+        auto& c = m_data->connections;
+
+        c += connect( model, &M::rowsInserted, this,
+            [ this ]( const QModelIndex& parent, int first, int last )
+            {
+                if ( !parent.isValid() )
+                {
+                    insertRowHeights( first, last - first + 1 );
+
+                    updateScrollableSize();
+                    updateSelectedRow();
+
+                    updateRows( first, rowCount() - 1 );
+                }
+            }
+        );
+
+        c += connect( model, &M::rowsRemoved, this,
+            [ this ]( const QModelIndex& parent, int first, int last )
+            {
+                if ( !parent.isValid() )
+                {
+                    removeRowHeights( first, last - first + 1 );
+
+                    updateScrollableSize();
+                    updateSelectedRow();
+
+                    updateRows( first, rowCount() + last - first );
+                    fetchMore();
+                }
+            }
+        );
+
+        c += connect( model, &M::dataChanged, this,
+            [ this ]( const QModelIndex& topLeft, const QModelIndex& bottomRight )
+            {
+                if ( !topLeft.parent().isValid() )
+                    updateRows( topLeft.row(), bottomRight.row() );
+            }
+        );
+
+        c += connect( model, &M::headerDataChanged, this,
+            [ this ]( Qt::Orientation orientation, int, int )
+            {
+                if ( orientation == Qt::Horizontal )
+                {
+                    updateScrollableSize();
+                    update();
+                }
+            }
+        );
+
+        for ( auto signal : { &M::columnsInserted, &M::columnsRemoved } )
+        {
+            c += connect( model, signal, this,
+                [ this ]( const QModelIndex& parent )
+                {
+                    if ( !parent.isValid() )
+                    {
+                        updateScrollableSize();
+                        update();
+                    }
+                }
+            );
+        }
+
+        c += connect( model, &M::rowsMoved,
+            this, &QskItemModelListView::resetModel );
+
+        c += connect( model, &M::layoutChanged,
+            this, &QskItemModelListView::resetModel );
+
+        c += connect( model, &M::modelReset,
+            this, &QskItemModelListView::resetModel );
+
+        c += connect( model, &QObject::destroyed, this,
+            [ this ]()
+            {
+                // the model is already half destroyed
+                m_data->model = nullptr;
+                m_data->connections.clear();
+
+                resetModel();
+                Q_EMIT modelChanged();
+            }
+        );
+    }
+
+    resetModel();
+
+    Q_EMIT modelChanged();
+}
+
+QAbstractItemModel* QskItemModelListView::model() const
+{
+    return m_data->model;
+}
+
+void QskItemModelListView::setRole( int role )
+{
+    if ( role != m_data->role )
+    {
+        m_data->role = role;
+        update();
+
+        Q_EMIT roleChanged( role );
+    }
+}
+
+int QskItemModelListView::role() const
+{
+    return m_data->role;
+}
+
+void QskItemModelListView::setColumnWidthHint( int column, qreal width )
+{
+    if ( column < 0 )
+        return;
+
+    auto& hints = m_data->columnWidthHints;
+
+    width = qMax( width, qreal( 0.0 ) );
+
+    if ( column >= hints.size() )
+    {
+        if ( width == 0.0 )
+            return;
+
+        hints.resize( column + 1 );
+    }
+
+    if ( width != hints[ column ] )
+    {
+        hints[ column ] = width;
+
+        updateScrollableSize();
+        update();
+    }
+}
+
+qreal QskItemModelListView::columnWidthHint( int column ) const
+{
+    const auto& hints = m_data->columnWidthHints;
+    return ( column >= 0 && column < hints.size() ) ? hints[ column ] : 0.0;
+}
+
+int QskItemModelListView::rowCount() const
+{
+    if ( const auto model = m_data->model )
+        return model->rowCount();
+
+    return 0;
+}
+
+int QskItemModelListView::columnCount() const
+{
+    if ( const auto model = m_data->model )
+        return model->columnCount();
+
+    return 0;
+}
+
+qreal QskItemModelListView::columnWidth( int col ) const
+{
+    if ( col < 0 || col >= columnCount() )
+        return 0.0;
+
+    const auto hint = columnWidthHint( col );
+    if ( hint > 0.0 )
+        return hint;
+
+    const auto value = m_data->model->headerData(
+        col, Qt::Horizontal, Qt::SizeHintRole );
+
+    if ( value.userType() == QMetaType::QSize )
+        return value.toSize().width();
+
+    if ( value.userType() == QMetaType::QSizeF )
+        return value.toSizeF().width();
+
+    return qMax( strutSizeHint( Cell ).width(), 0.0 );
+}
+
+qreal QskItemModelListView::rowHeight() const
+{
+    const auto hint = strutSizeHint( Cell );
+    const auto padding = paddingHint( Cell );
+
+    qreal h = effectiveFontHeight( Text );
+    h += padding.top() + padding.bottom();
+
+    return qMax( h, hint.height() );
+}
+
+QVariant QskItemModelListView::valueAt( int row, int col ) const
+{
+    if ( const auto model = m_data->model )
+        return model->data( model->index( row, col ), m_data->role );
+
+    return QVariant();
+}
+
+QModelIndex QskItemModelListView::selectedIndex() const
+{
+    return m_data->selectedIndex;
+}
+
+void QskItemModelListView::geometryChangeEvent( QskGeometryChangeEvent* event )
+{
+    Inherited::geometryChangeEvent( event );
+
+    // the view might have been enlarged
+    if ( event->isResized() )
+        fetchMore();
+}
+
+void QskItemModelListView::resetModel()
+{
+    resetRowHeights();
+
+    updateScrollableSize();
+    updateSelectedRow();
+
+    update();
+
+    fetchMore();
+}
+
+void QskItemModelListView::updateRows( int from, int to )
+{
+    /*
+        The nodes of the visible rows are the only ones, that
+        depend on the values of the model
+     */
+    const auto y = scrollPos().y();
+
+    const int rowMin = rowAtPosition( y );
+    if ( rowMin < 0 )
+    {
+        // scrolled beyond the rows
+        update();
+        return;
+    }
+
+    int rowMax = rowAtPosition( y + viewContentsRect().height() );
+    if ( rowMax < 0 )
+        rowMax = rowCount() - 1;
+
+    if ( from <= rowMax && to >= rowMin )
+        update();
+}
+
+void QskItemModelListView::updateSelectedRow()
+{
+    /*
+        The selection is stored as persistent index, that is
+        adjusted by the model, when rows are inserted/removed/moved.
+     */
+    const auto& index = m_data->selectedIndex;
+
+    int row = -1;
+    if ( m_data->model && index.isValid() && !index.parent().isValid() )
+        row = index.row();
+
+    if ( row != selectedRow() )
+        setSelectedRow( row );
+}
+
+void QskItemModelListView::fetchMore()
+{
+    auto model = m_data->model.data();
+
+    if ( model == nullptr || m_data->isFetching )
+        return;
+
+    m_data->isFetching = true;
+
+    while ( model->canFetchMore( QModelIndex() ) )
+    {
+        const int count = rowCount();
+
+        const auto y = scrollPos().y() + viewContentsRect().height();
+
+        const int row = rowAtPosition( y );
+        if ( row >= 0 && row < count - 1 )
+            break; // the last row is not visible
+
+        model->fetchMore( QModelIndex() );
+
+        if ( rowCount() == count )
+            break; // maybe the model is fetching asynchronously
+    }
+
+    m_data->isFetching = false;
+}
+
+#include "moc_QskItemModelListView.cpp"
@@ -0,0 +1,81 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) 2016 Uwe Rathmann
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#ifndef QSK_ITEM_MODEL_LIST_VIEW_H
+#define QSK_ITEM_MODEL_LIST_VIEW_H
+
+#include "QskListView.h"
+
+class QAbstractItemModel;
+class QModelIndex;
+
+/*
+    A list view for the top level rows of a QAbstractItemModel.
+
+    The values are retrieved from the model, when being needed
+    for the visible rows - nothing is copied. Changes of the model
+    only result in updates, when affecting the visible rows, and
+    when scrolling to the end of the rows more rows are fetched from
+    models supporting canFetchMore/fetchMore.
+
+    The widths of the columns can't be calculated without iterating
+    over all rows. So they have to be set explicitly or are taken from
+    the Qt::SizeHintRole of the horizontal header of the model.
+ */
+class QSK_EXPORT QskItemModelListView : public QskListView
+{
+    Q_OBJECT
+
+    Q_PROPERTY( QAbstractItemModel* model READ model
+        WRITE setModel NOTIFY modelChanged FINAL )
+
+    Q_PROPERTY( int role READ role WRITE setRole NOTIFY roleChanged FINAL )
+
+    using Inherited = QskListView;
+
+  public:
+    QskItemModelListView( QQuickItem* parent = nullptr );
+    QskItemModelListView( QAbstractItemModel*, QQuickItem* parent = nullptr );
+
+    ~QskItemModelListView() override;
+
+    void setModel( QAbstractItemModel* );
+    QAbstractItemModel* model() const;
+
+    // the role for the values of the cells, default: Qt::DisplayRole
+    void setRole( int );
+    int role() const;
+
+    void setColumnWidthHint( int column, qreal width );
+    qreal columnWidthHint( int column ) const;
+
+    int rowCount() const override final;
+    int columnCount() const override final;
+
+    qreal columnWidth( int col ) const override;
+    qreal rowHeight() const override;
+
+    QVariant valueAt( int row, int col ) const override final;
+
+    QModelIndex selectedIndex() const;
+
+  Q_SIGNALS:
+    void modelChanged();
+    void roleChanged( int );
+
+  protected:
+    void geometryChangeEvent( QskGeometryChangeEvent* ) override;
+
+  private:
+    void resetModel();
+    void updateRows( int from, int to );
+    void updateSelectedRow();
+    void fetchMore();
+
+    class PrivateData;
+    std::unique_ptr< PrivateData > m_data;
+};
+
+#endif
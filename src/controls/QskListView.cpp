@@ -14,6 +14,8 @@
 
 #include <qmath.h>
 
+#include <vector>
+
 QSK_SUBCONTROL( QskListView, Cell )
 QSK_SUBCONTROL( QskListView, Text )
 QSK_SUBCONTROL( QskListView, Graphic )
@@ -28,10 +30,7 @@ static inline int qskRowAt( const QskListView* listView, const QPointF& pos )
     if ( rect.contains( pos ) )
     {
         const auto y = pos.y() - rect.top() + listView->scrollPos().y();
-
-        const int row = y / listView->rowHeight();
-        if ( row >= 0 && row < listView->rowCount() )
-            return row;
+        return listView->rowAtPosition( y );
     }
 
     return -1;
@@ -95,6 +94,9 @@ class QskListView::PrivateData
     int hoveredRow = -1;
     int pressedRow = -1;
     int selectedRow = -1;
+
+    // only in use, when having individual row heights
+    QskRowExtents rowHeights;
 };
 
 QskListView::QskListView( QQuickItem* parent )
@@ -281,7 +283,9 @@ void QskListView::keyPressEvent( QKeyEvent* event )
     {
         auto pos = scrollPos();
 
-        const qreal rowPos = row * rowHeight();
+        const qreal rowPos = rowPosition( row );
+        const qreal rowHeight = rowHeightAt( row );
+
         if ( rowPos < scrollPos().y() )
         {
             pos.setY( rowPos );
@@ -291,9 +295,9 @@ void QskListView::keyPressEvent( QKeyEvent* event )
             const QRectF vr = viewContentsRect();
 
             const double scrolledBottom = scrollPos().y() + vr.height();
-            if ( rowPos + rowHeight() > scrolledBottom )
+            if ( rowPos + rowHeight > scrolledBottom )
             {
-                const double y = rowPos + rowHeight() - vr.height();
+                const double y = rowPos + rowHeight - vr.height();
                 pos.setY( y );
             }
         }
@@ -371,8 +375,25 @@ void QskListView::hoverLeaveEvent( QHoverEvent* event )
 
 void QskListView::changeEvent( QEvent* event )
 {
-    if ( event->type() == QEvent::StyleChange )
-        updateScrollableSize();
+    switch ( event->type() )
+    {
+        case QEvent::StyleChange:
+        {
+            updateEstimatedRowHeight();
+            updateScrollableSize();
+
+            break;
+        }
+        case QEvent::FontChange:
+        {
+            if ( updateEstimatedRowHeight() )
+                updateScrollableSize();
+
+            break;
+        }
+        default:
+            break;
+    }
 
     Inherited::changeEvent( event );
 }
@@ -398,20 +419,47 @@ QskAspect::States QskListView::rowStates( int row ) const
 
 #ifndef QT_NO_WHEELEVENT
 
-static qreal qskAlignedToRows( const qreal y0, qreal dy,
-    qreal rowHeight, qreal viewHeight )
+static qreal qskAlignedToRows( const QskListView* listView,
+    const qreal y0, qreal dy, qreal viewHeight )
 {
     qreal y = y0 - dy;
 
+    if ( !listView->hasVariableRowHeights() )
+    {
+        const auto rowHeight = listView->rowHeight();
+
+        if ( dy > 0 )
+        {
+            y = qFloor( y / rowHeight ) * rowHeight;
+        }
+        else
+        {
+            y += viewHeight;
+            y = qCeil( y / rowHeight ) * rowHeight;
+            y -= viewHeight;
+        }
+
+        return y;
+    }
+
+    const int maxRow = listView->rowCount();
+
     if ( dy > 0 )
     {
-        y = qFloor( y / rowHeight ) * rowHeight;
+        const int row = qBound( 0, listView->rowAtPosition( y ), maxRow );
+        y = listView->rowPosition( row );
     }
     else
     {
         y += viewHeight;
-        y = qCeil( y / rowHeight ) * rowHeight;
-        y -= viewHeight;
+
+        int row = listView->rowAtPosition( y );
+        if ( row < 0 || row >= maxRow )
+            row = maxRow;
+        else if ( listView->rowPosition( row ) < y )
+            row++;
+
+        y = listView->rowPosition( row ) - viewHeight;
     }
 
     return y;
@@ -457,7 +505,7 @@ QPointF QskListView::scrollOffset( const QWheelEvent* event ) const
         dy *= offset.y(); // multiplied by the wheelsteps
 
         // aligning rows that enter the view
-        dy = qskAlignedToRows( y0, dy, rowHeight, viewHeight );
+        dy = qskAlignedToRows( this, y0, dy, viewHeight );
 
         offset.setY( y0 - dy );
     }
@@ -469,9 +517,138 @@ QPointF QskListView::scrollOffset( const QWheelEvent* event ) const
 
 #endif
 
+void QskListView::setRowHeightAt( int row, qreal height )
+{
+    if ( row < 0 || row >= rowCount() )
+        return;
+
+    auto& rowHeights = m_data->rowHeights;
+
+    height = qMax( height, 0.0 );
+
+    if ( rowHeights.isEmpty() )
+        rowHeights.setEstimatedExtent( rowHeight() );
+
+    if ( height == rowHeights.extent( row ) )
+        return;
+
+    rowHeights.setExtent( row, height );
+
+    updateScrollableSize();
+    update();
+
+    Q_EMIT focusIndicatorRectChanged();
+}
+
+void QskListView::resetRowHeightAt( int row )
+{
+    auto& rowHeights = m_data->rowHeights;
+
+    if ( !rowHeights.hasExtent( row ) )
+        return;
+
+    rowHeights.resetExtent( row );
+
+    updateScrollableSize();
+    update();
+
+    Q_EMIT focusIndicatorRectChanged();
+}
+
+void QskListView::insertRowHeights( int row, int count )
+{
+    // the specific heights of the following rows are shifted
+    m_data->rowHeights.insertRows( row, count );
+}
+
+void QskListView::removeRowHeights( int row, int count )
+{
+    m_data->rowHeights.removeRows( row, count );
+}
+
+void QskListView::resetRowHeights()
+{
+    auto& rowHeights = m_data->rowHeights;
+
+    const bool hadRowHeights = !rowHeights.isEmpty();
+    rowHeights.clear();
+
+    // rowHeight() might have been changed
+    rowHeights.setEstimatedExtent( rowHeight() );
+
+    if ( hadRowHeights )
+    {
+        updateScrollableSize();
+        update();
+
+        Q_EMIT focusIndicatorRectChanged();
+    }
+}
+
+bool QskListView::updateEstimatedRowHeight()
+{
+    /*
+        The height of the rows without a specific height is cached, so
+        that positions and lookups don't need to call rowHeight().
+     */
+    auto& rowHeights = m_data->rowHeights;
+
+    const auto height = rowHeight();
+    if ( height == rowHeights.estimatedExtent() )
+        return false;
+
+    rowHeights.setEstimatedExtent( height );
+    return !rowHeights.isEmpty();
+}
+
+bool QskListView::hasVariableRowHeights() const
+{
+    return !m_data->rowHeights.isEmpty();
+}
+
+qreal QskListView::rowHeightAt( int row ) const
+{
+    if ( m_data->rowHeights.isEmpty() )
+        return rowHeight();
+
+    return m_data->rowHeights.extent( row );
+}
+
+qreal QskListView::rowPosition( int row ) const
+{
+    if ( m_data->rowHeights.isEmpty() )
+        return row * rowHeight();
+
+    return m_data->rowHeights.position( row );
+}
+
+int QskListView::rowAtPosition( qreal y ) const
+{
+    int row = -1;
+
+    if ( m_data->rowHeights.isEmpty() )
+    {
+        const auto h = rowHeight();
+        if ( y >= 0.0 && h > 0.0 )
+            row = static_cast< int >( y / h );
+    }
+    else
+    {
+        row = m_data->rowHeights.rowAt( y );
+    }
+
+    if ( row >= rowCount() )
+        row = -1;
+
+    return row;
+}
+
 void QskListView::updateScrollableSize()
 {
-    const double h = rowCount() * rowHeight();
+    // rows might have been removed
+    m_data->rowHeights.truncate( rowCount() );
+
+    const double h = rowPosition( rowCount() );
 
     qreal w = 0.0;
     for ( int col = 0; col < columnCount(); col++ )
@@ -60,8 +60,41 @@ class QSK_EXPORT QskListView : public QskScrollView
     virtual int columnCount() const = 0;
 
     virtual qreal columnWidth( int col ) const = 0;
+
+    /*
+        The height of rows, that have no specific height. Changes,
+        that are not caused by skin or font changes, have to be
+        indicated by calling resetRowHeights().
+     */
     virtual qreal rowHeight() const = 0;
 
+    /*
+        Rows can have individual heights, f.e. when wrapping texts. As
+        measuring all rows is usually too expensive, the heights
+        can be refined lazily - f.e. when a row becomes visible.
+        Positions and lookups are done in O(log n), while the memory
+        depends on the number of rows with an individual height only.
+     */
+    void setRowHeightAt( int row, qreal height );
+    void resetRowHeightAt( int row );
+    void resetRowHeights();
+
+    /*
+        Shifting the individual heights, when rows have been inserted
+        or removed. Otherwise they are attributed to the wrong rows
+        until calling resetRowHeights().
+     */
+    void insertRowHeights( int row, int count );
+    void removeRowHeights( int row, int count );
+
+    bool hasVariableRowHeights() const;
+
+    qreal rowHeightAt( int row ) const;
+    qreal rowPosition( int row ) const;
+
+    // -1, when being outside of the rows
+    int rowAtPosition( qreal y ) const;
+
     Q_INVOKABLE virtual QVariant valueAt( int row, int col ) const = 0;
 
     QRectF focusIndicatorRect() const override;
@@ -99,6 +132,8 @@ class QSK_EXPORT QskListView : public QskScrollView
     void componentComplete() override;
 
   private:
+    bool updateEstimatedRowHeight();
+
     class PrivateData;
     std::unique_ptr< PrivateData > m_data;
 };
@@ -16,6 +16,9 @@
 #include <qmath.h>
 #include <qsgnode.h>
 #include <qtransform.h>
+#include <qvector.h>
+
+#include <algorithm>
 
 namespace
 {
@@ -25,12 +28,15 @@ namespace
         void invalidate()
         {
             removeAllChildNodes();
-            m_columnCount = m_oldRowMin = m_oldRowMax = -1;
+            m_oldColumnMin = m_oldColumnMax = m_oldRowMin = m_oldRowMax = -1;
         }
 
-        void rearrangeNodes( int rowMin, int rowMax, int columnCount )
+        void rearrangeNodes( int rowMin, int rowMax, int columnMin, int columnMax )
         {
-            const bool doReorder = ( columnCount == m_columnCount )
+            const int columnCount = columnMax - columnMin + 1;
+
+            const bool doReorder =
+                ( columnMin == m_oldColumnMin ) && ( columnMax == m_oldColumnMax )
                 && ( rowMin <= m_oldRowMax ) && ( rowMax >= m_oldRowMin );
 
             if ( doReorder )
@@ -77,7 +83,8 @@ namespace
 
             m_oldRowMin = rowMin;
             m_oldRowMax = rowMax;
-            m_columnCount = columnCount;
+            m_oldColumnMin = columnMin;
+            m_oldColumnMax = columnMax;
         }
 
       private:
@@ -89,7 +96,9 @@ namespace
 
         int m_oldRowMin = -1;
         int m_oldRowMax = -1;
-        int m_columnCount = -1;
+
+        int m_oldColumnMin = -1;
+        int m_oldColumnMax = -1;
     };
 
     class ListViewNode final : public QSGTransformNode
@@ -112,13 +121,29 @@ namespace
             m_clipRect = listView->viewContentsRect();
             m_rowHeight = listView->rowHeight();
 
-            m_rowMin = qFloor( scrollPos.y() / m_rowHeight );
+            if ( listView->hasVariableRowHeights() )
+            {
+                const auto y1 = scrollPos.y();
+                const auto y2 = y1 + m_clipRect.height() - 10e-6;
+
+                m_rowMin = qMax( listView->rowAtPosition( y1 ), 0 );
 
-            const auto rowMax = ( scrollPos.y() + m_clipRect.height() ) / m_rowHeight;
-            m_rowMax = qFloor( rowMax - 10e-6 );
+                m_rowMax = listView->rowAtPosition( y2 );
+                if ( m_rowMax < 0 )
+                    m_rowMax = listView->rowCount() - 1;
+            }
+            else
+            {
+                m_rowMin = qFloor( scrollPos.y() / m_rowHeight );
+
+                const auto rowMax = ( scrollPos.y() + m_clipRect.height() ) / m_rowHeight;
+                m_rowMax = qFloor( rowMax - 10e-6 );
+            }
 
             if ( m_rowMax >= listView->rowCount() )
                 m_rowMax = listView->rowCount() - 1;
+
+            initializeColumns( listView, scrollPos.x() );
         }
 
         QRectF clipRect() const { return m_clipRect; }
@@ -129,16 +154,53 @@ namespace
 
         int rowHeight() const { return m_rowHeight; }
 
+        int columnMin() const { return m_columnMin; }
+        int columnMax() const { return m_columnMax; }
+
+        // relative to the left of the clip rectangle
+        qreal columnOffset( int col ) const { return m_columnOffsets[ col ]; }
+
         QSGNode* backgroundNode() { return &m_backgroundNode; }
         ForegroundNode* foregroundNode() { return &m_foregroundNode; }
 
       private:
+        void initializeColumns( const QskListView* listView, qreal scrollX )
+        {
+            const int columnCount = listView->columnCount();
+
+            m_columnOffsets.resize( columnCount + 1 );
+
+            qreal x = 0.0;
+            for ( int col = 0; col < columnCount; col++ )
+            {
+                m_columnOffsets[ col ] = x;
+                x += listView->columnWidth( col );
+            }
+            m_columnOffsets[ columnCount ] = x;
+
+            /*
+                Finding the columns intersecting the clip rectangle,
+                where column col covers [ offset[col], offset[col + 1] [
+             */
+            const auto begin = m_columnOffsets.cbegin();
+            const auto end = m_columnOffsets.cend() - 1;
+
+            const qreal xMin = scrollX;
+            const qreal xMax = scrollX + m_clipRect.width();
+
+            m_columnMin = qMax( int( std::upper_bound( begin, end, xMin ) - begin ) - 1, 0 );
+            m_columnMax = int( std::lower_bound( begin, end, xMax ) - begin ) - 1;
+        }
+
         // caching some calculations to speed things up
 
         QRectF m_clipRect;
         qreal m_rowHeight;
 
         int m_rowMin, m_rowMax;
+        int m_columnMin, m_columnMax;
+
+        QVector< qreal > m_columnOffsets;
 
         QSGNode m_backgroundNode;
         ForegroundNode m_foregroundNode;
@@ -239,56 +301,49 @@ void QskListViewSkinlet::updateForegroundNodes(
     const int rowMin = listViewNode->rowMin();
     const int rowMax = listViewNode->rowMax();
 
-    foregroundNode->rearrangeNodes( rowMin, rowMax, listView->columnCount() );
+    const int colMin = listViewNode->columnMin();
+    const int colMax = listViewNode->columnMax();
 
-#if 1
-    // should be optimized for visible columns only
-    const int colMin = 0;
-    const int colMax = listView->columnCount() - 1;
-#endif
+    foregroundNode->rearrangeNodes( rowMin, rowMax, colMin, colMax );
 
     const auto margins = listView->paddingHint( QskListView::Cell );
 
     updateVisibleForegroundNodes(
-        listView, foregroundNode, rowMin, rowMax, margins );
+        listView, foregroundNode, rowMin, rowMax, colMin, colMax, margins );
 
     // finally putting the nodes into their position
     auto node = foregroundNode->firstChild();
 
-    const auto rowHeight = listView->rowHeight();
-    auto y = clipRect.top() + rowMin * rowHeight;
-
     for ( int row = rowMin; row <= rowMax; row++ )
     {
-        qreal x = clipRect.left();
+        const auto y = clipRect.top() + listView->rowPosition( row );
 
         for ( int col = colMin; col <= colMax; col++ )
         {
             Q_ASSERT( node->type() == QSGNode::TransformNodeType );
             auto transformNode = static_cast< QSGTransformNode* >( node );
 
+            const auto x = clipRect.left() + listViewNode->columnOffset( col );
+
             transformNode->setMatrix(
                 QTransform::fromTranslate( x + margins.left(), y + margins.top() ) );
 
             node = node->nextSibling();
-            x += listView->columnWidth( col );
         }
-
-        y += rowHeight;
     }
 }
 
 void QskListViewSkinlet::updateVisibleForegroundNodes(
     const QskListView* listView, QSGNode* parentNode,
-    int rowMin, int rowMax, const QMarginsF& margins ) const
+    int rowMin, int rowMax, int colMin, int colMax, const QMarginsF& margins ) const
 {
     auto node = parentNode->firstChild();
 
     for ( int row = rowMin; row <= rowMax; row++ )
     {
-        const auto h = listView->rowHeight() - ( margins.top() + margins.bottom() );
+        const auto h = listView->rowHeightAt( row ) - ( margins.top() + margins.bottom() );
 
-        for ( int col = 0; col < listView->columnCount(); col++ )
+        for ( int col = colMin; col <= colMax; col++ )
         {
             const auto w = listView->columnWidth( col ) - ( margins.left() + margins.right() );
 
@@ -485,9 +540,9 @@ QRectF QskListViewSkinlet::sampleRect( const QskSkinnable* skinnable,
         const auto clipRect = node ? node->clipRect() : listView->viewContentsRect();
 
         const auto w = clipRect.width();
-        const auto h = listView->rowHeight();
+        const auto h = listView->rowHeightAt( index );
         const auto x = clipRect.left() + listView->scrollPos().x();
-        const auto y = clipRect.top() + index * h;
+        const auto y = clipRect.top() + listView->rowPosition( index );
 
         return QRectF( x, y, w, h );
     }
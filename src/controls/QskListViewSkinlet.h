@@ -52,7 +52,8 @@ class QSK_EXPORT QskListViewSkinlet : public QskScrollViewSkinlet
 
     void updateVisibleForegroundNodes(
         const QskListView*, QSGNode*,
-        int rowMin, int rowMax, const QMarginsF& margin ) const;
+        int rowMin, int rowMax, int colMin, int colMax,
+        const QMarginsF& margin ) const;
 
     QSGTransformNode* updateForegroundNode( const QskListView*,
         QSGNode* parentNode, QSGTransformNode* cellNode,
@@ -17,6 +17,7 @@
 #include <qvector.h>
 #include <qvariant.h>
 #include <qeventloop.h>
+#include <qquickwindow.h>
 
 QSK_QT_PRIVATE_BEGIN
 #include <private/qquickitem_p.h>
@@ -491,6 +492,34 @@ void QskMenu::mouseReleaseEvent( QMouseEvent* event )
     Inherited::mouseReleaseEvent( event );
 }
 
+void QskMenu::geometryChangeEvent( QskGeometryChangeEvent* event )
+{
+    Inherited::geometryChangeEvent( event );
+
+    // the visible options depend on the geometry inside the window
+    if ( event->isMoved() || event->isResized() )
+        update();
+}
+
+void QskMenu::windowChangeEvent( QskWindowChangeEvent* event )
+{
+    // the visible options also depend on the size of the window
+
+    if ( auto window = event->oldWindow() )
+    {
+        disconnect( window, &QQuickWindow::widthChanged, this, &QQuickItem::update );
+        disconnect( window, &QQuickWindow::heightChanged, this, &QQuickItem::update );
+    }
+
+    if ( auto window = event->window() )
+    {
+        connect( window, &QQuickWindow::widthChanged, this, &QQuickItem::update );
+        connect( window, &QQuickWindow::heightChanged, this, &QQuickItem::update );
+    }
+
+    Inherited::windowChangeEvent( event );
+}
+
 void QskMenu::aboutToShow()
 {
     setSize( sizeConstraint() );
@@ -115,6 +115,9 @@ class QSK_EXPORT QskMenu : public QskPopup
     void mouseUngrabEvent() override;
     void mouseReleaseEvent( QMouseEvent* ) override;
 
+    void geometryChangeEvent( QskGeometryChangeEvent* ) override;
+    void windowChangeEvent( QskWindowChangeEvent* ) override;
+
     void aboutToShow() override;
     void trigger( int );
 
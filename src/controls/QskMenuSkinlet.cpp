@@ -18,6 +18,7 @@
 
 #include <qfontmetrics.h>
 #include <qmath.h>
+#include <qquickwindow.h>
 
 static inline int qskActionIndex( const QskMenu* menu, int optionIndex )
 {
@@ -42,6 +43,47 @@ static inline qreal qskPaddedSeparatorHeight( const QskMenu* menu )
         + margins.top() + margins.bottom();
 }
 
+/*
+    Segments and separators are stacked vertically, so that the position
+    of an item depends on the number of items of the other type in front
+    of it. Returning the first item of the list, that ends below y.
+ */
+static int qskLowerIndex( const QVector< int >& indexes,
+    qreal height, qreal otherHeight, qreal y )
+{
+    int lower = 0;
+    int upper = indexes.count();
+
+    while ( lower < upper )
+    {
+        const int mid = ( lower + upper ) / 2;
+        const auto bottom = ( mid + 1 ) * height + ( indexes[ mid ] - mid ) * otherHeight;
+
+        if ( bottom <= y )
+            lower = mid + 1;
+        else
+            upper = mid;
+    }
+
+    return lower;
+}
+
+static QRectF qskVisibleRect( const QskMenu* menu )
+{
+    auto rect = menu->rect();
+
+    if ( const auto window = menu->window() )
+    {
+        const QRectF windowRect( 0.0, 0.0, window->width(), window->height() );
+        rect &= menu->mapRectFromScene( windowRect );
+    }
+
+    if ( menu->clip() )
+        rect &= menu->clipRect();
+
+    return rect;
+}
+
 class QskMenuSkinlet::PrivateData
 {
   public:
@@ -50,17 +92,22 @@ class QskMenuSkinlet::PrivateData
       public:
         CacheGuard( PrivateData* data )
             : m_data( data )
+            , m_isNested( data->m_isCaching )
         {
-            m_data->enableCache( true );
+            // sampleIndexAt might be called while updating the nodes
+            if ( !m_isNested )
+                m_data->enableCache( true );
         }
 
         ~CacheGuard()
         {
-            m_data->enableCache( false );
+            if ( !m_isNested )
+                m_data->enableCache( false );
         }
 
       private:
         PrivateData* m_data;
+        const bool m_isNested;
     };
 
     void enableCache( bool on )
@@ -134,7 +181,20 @@ class QskMenuSkinlet::PrivateData
         const auto options = menu->options();
         for ( auto& option : options )
         {
-            const auto graphic = option.icon().graphic();
+            const auto icon = option.icon();
+
+            if ( hint.width() > 0.0 && !icon.source().isEmpty() )
+            {
+                /*
+                    Graphics from sources are loaded lazily, when the
+                    option becomes visible - they have to fit into the strut.
+                 */
+                continue;
+            }
+
+            const auto graphic = icon.source().isEmpty()
+                ? icon.maybeGraphic() : icon.graphic();
+
             if ( !graphic.isNull() )
             {
                 const auto w = graphic.widthForHeight( h );
@@ -198,7 +258,7 @@ class QskMenuSkinlet::PrivateData
         return h;
     }
 
-    bool m_isCaching;
+    bool m_isCaching = false;
 
     mutable qreal m_graphicWidth = -1.0;
     mutable qreal m_textWidth = -1.0;
@@ -367,7 +427,7 @@ QRectF QskMenuSkinlet::sampleRect(
             y += n * m_data->segmentHeight( menu );
 
         const auto r = menu->subControlContentsRect( Q::Panel );
-        return QRectF( r.left(), y, r.width(), h );
+        return QRectF( r.left(), r.top() + y, r.width(), h );
     }
 
     return Inherited::sampleRect(
@@ -378,7 +438,28 @@ int QskMenuSkinlet::sampleIndexAt(
     const QskSkinnable* skinnable, const QRectF& contentsRect,
     QskAspect::Subcontrol subControl, const QPointF& pos ) const
 {
+    using Q = QskMenu;
+
     const PrivateData::CacheGuard guard( m_data.get() );
+
+    if ( subControl == Q::Segment )
+    {
+        const auto menu = static_cast< const QskMenu* >( skinnable );
+        const auto r = menu->subControlContentsRect( Q::Panel );
+
+        const auto index = qskLowerIndex( menu->actions(),
+            m_data->segmentHeight( menu ), qskPaddedSeparatorHeight( menu ),
+            pos.y() - r.top() );
+
+        if ( index < menu->actions().count() )
+        {
+            if ( sampleRect( skinnable, contentsRect, subControl, index ).contains( pos ) )
+                return index;
+        }
+
+        return -1;
+    }
+
     return Inherited::sampleIndexAt( skinnable, contentsRect, subControl, pos );
 }
 
@@ -431,7 +512,8 @@ QskAspect::States QskMenuSkinlet::sampleStates(
         const auto cursorPos = menu->effectiveSkinHint(
             Q::Segment | Q::Hovered | A::Metric | A::Position ).toPointF();
 
-        if( !cursorPos.isNull() && menu->indexAtPosition( cursorPos ) == index )
+        if( !cursorPos.isNull() && sampleIndexAt( skinnable,
+            menu->contentsRect(), Q::Segment, cursorPos ) == index )
         {
             states |= Q::Hovered;
         }
@@ -474,12 +556,46 @@ QSGNode* QskMenuSkinlet::updateContentsNode(
 QSGNode* QskMenuSkinlet::updateMenuNode(
     const QskSkinnable* skinnable, QSGNode* contentsNode ) const
 {
+    using Q = QskMenu;
+
     enum { Panel, Segment, Cursor, Icon, Text, Separator };
     static QVector< quint8 > roles = { Panel, Separator, Segment, Cursor, Icon, Text };
 
     if ( contentsNode == nullptr )
         contentsNode = new QSGNode();
 
+    const auto menu = static_cast< const QskMenu* >( skinnable );
+
+    /*
+        Only the segments and separators inside the visible part
+        of the menu are updated. The nodes are recycled by position,
+        so that nothing is allocated, when the visible part is changing.
+     */
+
+    int actionsFrom = 0, actionsTo = 0;
+    int separatorsFrom = 0, separatorsTo = 0;
+
+    const auto visibleRect = qskVisibleRect( menu );
+    if ( !visibleRect.isEmpty() )
+    {
+        const auto actions = menu->actions();
+        const auto separators = menu->separators();
+
+        const auto h = m_data->segmentHeight( menu );
+        const auto sh = qskPaddedSeparatorHeight( menu );
+
+        const auto top = menu->subControlContentsRect( Q::Panel ).top();
+
+        const auto y1 = visibleRect.top() - top;
+        const auto y2 = visibleRect.bottom() - top;
+
+        actionsFrom = qskLowerIndex( actions, h, sh, y1 );
+        actionsTo = qMin( qskLowerIndex( actions, h, sh, y2 ) + 1, actions.count() );
+
+        separatorsFrom = qskLowerIndex( separators, sh, h, y1 );
+        separatorsTo = qMin( qskLowerIndex( separators, sh, h, y2 ) + 1, separators.count() );
+    }
+
     for ( const auto role : roles )
     {
         auto oldNode = QskSGNode::findChildNode( contentsNode, role );
@@ -495,7 +611,8 @@ QSGNode* QskMenuSkinlet::updateMenuNode(
             }
             case Segment:
             {
-                newNode = updateSeriesNode( skinnable, QskMenu::Segment, oldNode );
+                newNode = updateSeriesNode( skinnable,
+                    Q::Segment, actionsFrom, actionsTo, oldNode );
                 break;
             }
             case Cursor:
@@ -505,17 +622,20 @@ QSGNode* QskMenuSkinlet::updateMenuNode(
             }
             case Icon:
             {
-                newNode = updateSeriesNode( skinnable, QskMenu::Icon, oldNode );
+                newNode = updateSeriesNode( skinnable,
+                    Q::Icon, actionsFrom, actionsTo, oldNode );
                 break;
             }
             case Text:
             {
-                newNode = updateSeriesNode( skinnable, QskMenu::Text, oldNode );
+                newNode = updateSeriesNode( skinnable,
+                    Q::Text, actionsFrom, actionsTo, oldNode );
                 break;
             }
             case Separator:
             {
-                newNode = updateSeriesNode( skinnable, QskMenu::Separator, oldNode );
+                newNode = updateSeriesNode( skinnable,
+                    Q::Separator, separatorsFrom, separatorsTo, oldNode );
                 break;
             }
         }
@@ -50,7 +50,13 @@ namespace
 QskPushButtonSkinlet::QskPushButtonSkinlet( QskSkin* skin )
     : Inherited( skin )
 {
+    using Q = QskPushButton;
+
     setNodeRoles( { PanelRole, SplashRole, IconRole, TextRole } );
+
+    setNodeRoleSubcontrols( PanelRole, { Q::Panel } );
+    setNodeRoleSubcontrols( IconRole, { Q::Icon } );
+    setNodeRoleSubcontrols( TextRole, { Q::Text } );
 }
 
 QskPushButtonSkinlet::~QskPushButtonSkinlet() = default;
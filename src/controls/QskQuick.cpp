@@ -6,6 +6,7 @@
 #include "QskQuick.h"
 #include "QskControl.h"
 #include "QskFunctions.h"
+#include "QskLayerNode.h"
 #include "QskLayoutElement.h"
 #include "QskPlatform.h"
 #include <qquickitem.h>
@@ -394,7 +395,13 @@ const QSGNode* qskPaintNode( const QQuickItem* item )
     if ( item == nullptr )
         return nullptr;
 
-    return QQuickItemPrivate::get( item )->paintNode;
+    auto node = QQuickItemPrivate::get( item )->paintNode;
+
+    // with QskQuickItem::CacheAsTexture the paint node is wrapped
+    if ( auto layerNode = dynamic_cast< const QskLayerNode* >( node ) )
+        return layerNode->contentNode();
+
+    return node;
 }
 
 const QSGRootNode* qskScenegraphAnchorNode( const QQuickItem* item )
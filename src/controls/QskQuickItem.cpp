@@ -10,6 +10,7 @@
 #include "QskSetup.h"
 #include "QskSkin.h"
 #include "QskDirtyItemFilter.h"
+#include "QskLayerNode.h"
 
 #include <qglobalstatic.h>
 #include <qquickwindow.h>
@@ -442,7 +443,8 @@ bool QskQuickItem::maybeUnresized() const
     {
         /*
             Unfortunately the list of items to-be-polished is not processed
-            in top/down order and we might run into updatePolish() before
+            in top/down order ( beside the situations, where it has been ordered
+            by QskWindow ) and we might run into updatePolish() before
             having a proper size. But when the parentItem() is waiting
             for to-be-polished, we assume, that we will be resized then
             and run into another updatePolish() then.
@@ -523,7 +525,8 @@ void QskQuickItem::applyUpdateFlag( UpdateFlag flag, bool on )
             }
             else
             {
-                if ( !isVisible() )
+                // the item might have been blocked being invisible or off-window
+                if ( !isVisible() || d->dirtyAttributes )
                     update();
             }
 
@@ -560,6 +563,20 @@ void QskQuickItem::applyUpdateFlag( UpdateFlag flag, bool on )
 
             break;
         }
+        case QskQuickItem::CacheAsTexture:
+        {
+            /*
+                The layer node needs a QSGRootNode above the paint
+                node for rendering the subtree into a texture
+             */
+            qskSetScenegraphAnchor( this, on );
+
+            d->clearPreviousNodes = true;
+            if ( flags() & QQuickItem::ItemHasContents )
+                update();
+
+            break;
+        }
         case QskQuickItem::DebugForceBackground:
         {
             // no need to mark it dirty
@@ -576,6 +593,8 @@ void QskQuickItem::resetImplicitSize()
 {
     Q_D( QskQuickItem );
 
+    d->invalidateSizeHints();
+
     if ( d->updateFlags & QskQuickItem::DeferredLayout )
     {
         d->blockedImplicitSize = true;
@@ -673,6 +692,16 @@ bool QskQuickItem::event( QEvent* event )
 
             return true;
         }
+        case QskEvent::ItemLayoutRequest:
+        {
+            /*
+                Not interested in the item, that has sent the request:
+                continuing with a plain QEvent::LayoutRequest, so that
+                event handlers and filters don't need to know about it.
+             */
+            QEvent layoutRequest( QEvent::LayoutRequest );
+            return QCoreApplication::sendEvent( this, &layoutRequest );
+        }
         case QEvent::FocusIn:
         {
             if ( window() == nullptr )
@@ -955,6 +984,18 @@ QSGNode* QskQuickItem::updatePaintNode( QSGNode* node, UpdatePaintNodeData* data
         d->clearPreviousNodes = false;
     }
 
+    if ( d->updateFlags & QskQuickItem::CacheAsTexture )
+    {
+        auto layerNode = static_cast< QskLayerNode* >( node );
+        if ( layerNode == nullptr )
+            layerNode = new QskLayerNode();
+
+        layerNode->setContentNode( updateItemPaintNode( layerNode->contentNode() ) );
+        layerNode->updateNode( this );
+
+        return layerNode;
+    }
+
     return updateItemPaintNode( node );
 }
 
@@ -43,6 +43,7 @@ class QSK_EXPORT QskQuickItem : public QQuickItem
         CleanupOnVisibility     =  1 << 3,
 
         PreferRasterForTextures =  1 << 4,
+        CacheAsTexture          =  1 << 5,
 
         DebugForceBackground    =  1 << 7
     };
@@ -6,6 +6,7 @@
 #include "QskQuickItemPrivate.h"
 #include "QskTreeNode.h"
 #include "QskSetup.h"
+#include "QskEvent.h"
 
 static inline void qskSendEventTo( QObject* object, QEvent::Type type )
 {
@@ -85,8 +86,21 @@ void QskQuickItemPrivate::applyUpdateFlags( QskQuickItem::UpdateFlags flags )
 
 void QskQuickItemPrivate::layoutConstraintChanged()
 {
-    if ( auto item = q_func()->parentItem() )
-        qskSendEventTo( item, QEvent::LayoutRequest );
+    Q_Q( QskQuickItem );
+
+    if ( auto item = q->parentItem() )
+    {
+        if ( qobject_cast< const QskQuickItem* >( item ) )
+        {
+            QskLayoutRequestEvent event( q );
+            QCoreApplication::sendEvent( item, &event );
+        }
+        else
+        {
+            QEvent event( QEvent::LayoutRequest );
+            QCoreApplication::sendEvent( item, &event );
+        }
+    }
 }
 
 void QskQuickItemPrivate::implicitSizeChanged()
@@ -94,6 +108,10 @@ void QskQuickItemPrivate::implicitSizeChanged()
     layoutConstraintChanged();
 }
 
+void QskQuickItemPrivate::invalidateSizeHints()
+{
+}
+
 qreal QskQuickItemPrivate::getImplicitWidth() const
 {
     if ( blockedImplicitSize )
@@ -29,6 +29,9 @@ class QskQuickItemPrivate : public QQuickItemPrivate
     virtual void layoutConstraintChanged();
     virtual void implicitSizeChanged();
 
+    // called from QskQuickItem::resetImplicitSize
+    virtual void invalidateSizeHints();
+
   private:
     void cleanupNodes();
     void mirrorChange() override;
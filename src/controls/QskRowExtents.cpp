@@ -0,0 +1,272 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) 2016 Uwe Rathmann
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#include "QskRowExtents.h"
+#include <qvector.h>
+
+QskRowExtents::QskRowExtents()
+{
+}
+
+void QskRowExtents::clear()
+{
+    m_extents.clear();
+    m_tree.clear();
+    m_capacity = 0;
+}
+
+bool QskRowExtents::isEmpty() const
+{
+    return m_extents.isEmpty();
+}
+
+void QskRowExtents::setEstimatedExtent( qreal extent )
+{
+    // the tree stores the explicit extents only: nothing to update
+    m_estimatedExtent = qMax( extent, 0.0 );
+}
+
+qreal QskRowExtents::estimatedExtent() const
+{
+    return m_estimatedExtent;
+}
+
+void QskRowExtents::setSpacing( qreal spacing )
+{
+    m_spacing = qMax( spacing, 0.0 );
+}
+
+qreal QskRowExtents::spacing() const
+{
+    return m_spacing;
+}
+
+void QskRowExtents::setExtent( int row, qreal extent )
+{
+    if ( row < 0 )
+        return;
+
+    if ( extent < 0.0 )
+    {
+        resetExtent( row );
+        return;
+    }
+
+    auto it = m_extents.find( row );
+    if ( it != m_extents.end() )
+    {
+        if ( it.value() != extent )
+        {
+            add( row, extent - it.value(), 0 );
+            it.value() = extent;
+        }
+    }
+    else
+    {
+        m_extents.insert( row, extent );
+        add( row, extent, 1 );
+    }
+}
+
+void QskRowExtents::resetExtent( int row )
+{
+    auto it = m_extents.find( row );
+    if ( it != m_extents.end() )
+    {
+        add( row, -it.value(), -1 );
+        m_extents.erase( it );
+    }
+}
+
+qreal QskRowExtents::extent( int row ) const
+{
+    return m_extents.value( row, m_estimatedExtent );
+}
+
+bool QskRowExtents::hasExtent( int row ) const
+{
+    return m_extents.contains( row );
+}
+
+void QskRowExtents::insertRows( int row, int count )
+{
+    if ( count <= 0 )
+        return;
+
+    QHash< int, qreal > extents;
+    extents.reserve( m_extents.size() );
+
+    bool isShifted = false;
+
+    for ( auto it = m_extents.constBegin(); it != m_extents.constEnd(); ++it )
+    {
+        auto key = it.key();
+        if ( key >= row )
+        {
+            key += count;
+            isShifted = true;
+        }
+
+        extents.insert( key, it.value() );
+    }
+
+    if ( isShifted )
+        rebuild( extents );
+}
+
+void QskRowExtents::removeRows( int row, int count )
+{
+    if ( count <= 0 )
+        return;
+
+    QHash< int, qreal > extents;
+    extents.reserve( m_extents.size() );
+
+    bool isShifted = false;
+
+    for ( auto it = m_extents.constBegin(); it != m_extents.constEnd(); ++it )
+    {
+        const auto key = it.key();
+
+        if ( key < row )
+        {
+            extents.insert( key, it.value() );
+        }
+        else
+        {
+            if ( key >= row + count )
+                extents.insert( key - count, it.value() );
+
+            isShifted = true;
+        }
+    }
+
+    if ( isShifted )
+        rebuild( extents );
+}
+
+void QskRowExtents::truncate( int rowCount )
+{
+    QVector< int > rows;
+
+    for ( auto it = m_extents.constBegin(); it != m_extents.constEnd(); ++it )
+    {
+        if ( it.key() >= rowCount )
+            rows += it.key();
+    }
+
+    for ( const auto row : std::as_const( rows ) )
+        resetExtent( row );
+}
+
+qreal QskRowExtents::position( int row ) const
+{
+    if ( row <= 0 )
+        return 0.0;
+
+    const auto node = sum( row );
+    return node.extent + ( row - node.count ) * m_estimatedExtent + row * m_spacing;
+}
+
+int QskRowExtents::rowAt( qreal pos ) const
+{
+    if ( pos < 0.0 )
+        return -1;
+
+    int row = 0;
+    qreal rowPos = 0.0;
+
+    // descending the tree from the root
+
+    for ( int step = m_capacity; step > 0; step /= 2 )
+    {
+        const int next = row + step;
+        if ( next > m_capacity )
+            continue;
+
+        const auto node = m_tree.value( next );
+
+        const qreal nextPos = rowPos + node.extent
+            + ( step - node.count ) * m_estimatedExtent + step * m_spacing;
+
+        if ( nextPos <= pos )
+        {
+            row = next;
+            rowPos = nextPos;
+        }
+    }
+
+    const auto extent = m_estimatedExtent + m_spacing;
+
+    if ( row == m_capacity && extent > 0.0 )
+    {
+        // beyond the explicit extents
+        row += static_cast< int >( ( pos - rowPos ) / extent );
+    }
+
+    return row;
+}
+
+void QskRowExtents::rebuild( const QHash< int, qreal >& extents )
+{
+    clear();
+
+    for ( auto it = extents.constBegin(); it != extents.constEnd(); ++it )
+        setExtent( it.key(), it.value() );
+}
+
+void QskRowExtents::add( int row, qreal extent, int count )
+{
+    const int index = row + 1; // Fenwick indexes are 1 based
+
+    while ( m_capacity < index )
+    {
+        if ( m_capacity == 0 )
+        {
+            m_capacity = 1;
+        }
+        else
+        {
+            /*
+                The new root covers all previous nodes, while
+                the other new nodes cover empty ranges.
+             */
+            const auto node = sum( m_capacity );
+
+            m_capacity *= 2;
+
+            if ( node.count > 0 )
+                m_tree.insert( m_capacity, node );
+        }
+    }
+
+    for ( int i = index; i <= m_capacity; i += i & -i )
+    {
+        auto& node = m_tree[ i ];
+
+        node.extent += extent;
+        node.count += count;
+
+        if ( node.count == 0 )
+            m_tree.remove( i ); // keeping the tree sparse
+    }
+}
+
+QskRowExtents::Node QskRowExtents::sum( int rowCount ) const
+{
+    Node node;
+
+    for ( int i = qMin( rowCount, m_capacity ); i > 0; i -= i & -i )
+    {
+        const auto it = m_tree.constFind( i );
+        if ( it != m_tree.constEnd() )
+        {
+            node.extent += it->extent;
+            node.count += it->count;
+        }
+    }
+
+    return node;
+}
@@ -0,0 +1,80 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) 2016 Uwe Rathmann
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#ifndef QSK_ROW_EXTENTS_H
+#define QSK_ROW_EXTENTS_H
+
+#include "QskGlobal.h"
+#include <qhash.h>
+
+/*
+    The extents of a long list of rows, where rows without an explicit
+    extent - usually a measured one - have the estimated extent.
+
+    Only the explicit extents are stored: the sums of them are organized
+    in a sparse Fenwick tree, so that positions and lookups can be done
+    in O(log n), while the memory depends on the number of explicit
+    extents only. The estimated extent and the spacing between the rows
+    can be changed in O(1).
+
+    Inserting/removing rows shifts the explicit extents behind, what
+    is done by rebuilding the tree - O(m * log n) for m explicit extents.
+ */
+class QskRowExtents
+{
+  public:
+    QskRowExtents();
+
+    void clear();
+    bool isEmpty() const;
+
+    void setEstimatedExtent( qreal );
+    qreal estimatedExtent() const;
+
+    void setSpacing( qreal );
+    qreal spacing() const;
+
+    // extent < 0: estimated
+    void setExtent( int row, qreal extent );
+    void resetExtent( int row );
+
+    qreal extent( int row ) const;
+    bool hasExtent( int row ) const;
+
+    void insertRows( int row, int count );
+    void removeRows( int row, int count );
+
+    // resetting the extents of all rows >= rowCount
+    void truncate( int rowCount );
+
+    // the start of the row, including the spacing of the previous rows
+    qreal position( int row ) const;
+
+    // the row, where position( row ) <= pos < position( row + 1 )
+    int rowAt( qreal pos ) const;
+
+  private:
+    class Node
+    {
+      public:
+        qreal extent = 0.0;
+        int count = 0;
+    };
+
+    void rebuild( const QHash< int, qreal >& );
+
+    void add( int row, qreal extent, int count );
+    Node sum( int rowCount ) const;
+
+    qreal m_estimatedExtent = 0.0;
+    qreal m_spacing = 0.0;
+
+    int m_capacity = 0; // a power of 2
+
+    QHash< int, qreal > m_extents; // the explicit extents
+    QHash< int, Node > m_tree; // Fenwick indexes are 1 based
+};
+
+#endif
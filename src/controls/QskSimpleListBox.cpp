@@ -7,38 +7,102 @@
 #include "QskAspect.h"
 #include "QskFunctions.h"
 
+#include <qcoreapplication.h>
 #include <qfontmetrics.h>
+#include <qpointer.h>
+#include <qrunnable.h>
+#include <qthreadpool.h>
+#include <qvector.h>
 
-static inline qreal qskMaxWidth(
-    const QFont& font, const QStringList& list )
+#include <map>
+
+/*
+    Measuring the texts of many entries takes some time,
+    so it is done in a worker thread for larger lists.
+ */
+static const int qskAsyncMeasureCount = 1000;
+
+class QskSimpleListBox::PrivateData
 {
-    const QFontMetricsF fm( font );
+  public:
+    inline qreal maxTextWidth() const
+    {
+        return widthCounts.empty() ? 0.0 : widthCounts.rbegin()->first;
+    }
 
-    qreal max = 0.0;
-    for ( int i = 0; i < list.size(); i++ )
+    void setWidth( int row, qreal width )
     {
-        const qreal w = qskHorizontalAdvance( fm, list[ i ] );
-        if ( w > max )
-            max = w;
+        removeWidth( widths[ row ] );
+        widths[ row ] = width;
+        addWidth( width );
     }
 
-    return max;
-}
+    void insertEntries( int index, const QStringList& list )
+    {
+        if ( entries.isEmpty() )
+            entries = list;
+        else if ( index == entries.size() )
+            entries += list;
+        else
+        {
+            // is there no better way ???
+            for ( int i = 0; i < list.size(); i++ )
+                entries.insert( index + i, list[ i ] );
+        }
 
-class QskSimpleListBox::PrivateData
-{
-  public:
-    PrivateData()
-        : maxTextWidth( 0.0 )
-        , columnWidthHint( 0.0 )
+        widths.insert( index, list.size(), -1.0 );
+    }
+
+    void removeEntries( int from, int to )
     {
+        for ( int i = from; i <= to; i++ )
+            removeWidth( widths[ i ] );
+
+        entries.erase( entries.begin() + from, entries.begin() + to + 1 );
+        widths.remove( from, to - from + 1 );
     }
 
-    // one column at the moment only
-    qreal maxTextWidth;
-    qreal columnWidthHint;
+    void invalidateWidths()
+    {
+        widthCounts.clear();
+        widths.fill( -1.0 );
+
+        generation++;
+    }
+
+    qreal columnWidthHint = 0.0;
 
     QStringList entries;
+
+    /*
+        The widths of the entries - < 0, when not being measured yet -
+        and a histogram of them, so that we always know the
+        maximum without having to iterate over all entries.
+     */
+    QVector< qreal > widths;
+    std::map< qreal, int > widthCounts;
+
+    // incremented, whenever the measured widths become invalid
+    int generation = 0;
+
+    bool isMeasuring = false;
+
+  private:
+    inline void addWidth( qreal width )
+    {
+        if ( width >= 0.0 )
+            widthCounts[ width ]++;
+    }
+
+    inline void removeWidth( qreal width )
+    {
+        if ( width >= 0.0 )
+        {
+            auto it = widthCounts.find( width );
+            if ( it != widthCounts.end() && --it->second == 0 )
+                widthCounts.erase( it );
+        }
+    }
 };
 
 QskSimpleListBox::QskSimpleListBox( QQuickItem* parent )
@@ -74,14 +138,17 @@ void QskSimpleListBox::setColumnWidthHint( int column, qreal width )
     if ( column != 0 )
         return;
 
+    width = qMax( width, qreal( 0.0 ) );
+
     if ( width != m_data->columnWidthHint )
     {
-        m_data->columnWidthHint = qMax( width, qreal( 0.0 ) );
+        m_data->columnWidthHint = width;
 
-        if ( m_data->columnWidthHint > 0.0 )
-            m_data->maxTextWidth = m_data->columnWidthHint;
-        else
-            m_data->maxTextWidth = qskMaxWidth( effectiveFont( Text ), m_data->entries );
+        if ( width <= 0.0 )
+        {
+            // the widths have not been measured while having a hint
+            measureWidths();
+        }
 
         updateScrollableSize();
     }
@@ -100,26 +167,21 @@ void QskSimpleListBox::insert( const QStringList& list, int index )
     if ( list.isEmpty() )
         return;
 
-    if ( m_data->columnWidthHint <= 0.0 )
-    {
-        const auto w = qskMaxWidth( effectiveFont( Text ), list );
-        if ( w > m_data->maxTextWidth )
-            m_data->maxTextWidth = w;
-    }
+    if ( index < 0 || index > m_data->entries.size() )
+        index = m_data->entries.size();
 
-    if ( m_data->entries.isEmpty() )
-    {
-        m_data->entries = list;
-    }
-    else if ( index < 0 || index >= m_data->entries.size() )
+    m_data->insertEntries( index, list );
+
+    if ( list.size() >= qskAsyncMeasureCount )
     {
-        m_data->entries += list;
+        measureWidths();
     }
-    else
+    else if ( m_data->columnWidthHint <= 0.0 )
     {
-        // is there no better way ???
+        const QFontMetricsF fm( effectiveFont( Text ) );
+
         for ( int i = 0; i < list.size(); i++ )
-            m_data->entries.insert( index + i, list[ i ] );
+            m_data->setWidth( index + i, qskHorizontalAdvance( fm, list[ i ] ) );
     }
 
     propagateEntries();
@@ -131,9 +193,8 @@ void QskSimpleListBox::setEntries( const QStringList& entries )
         return;
 
     m_data->entries.clear();
-
-    if ( m_data->columnWidthHint <= 0.0 )
-        m_data->maxTextWidth = 0.0;
+    m_data->widths.clear();
+    m_data->widthCounts.clear();
 
     insert( entries, -1 );
 }
@@ -145,19 +206,7 @@ QStringList QskSimpleListBox::entries() const
 
 void QskSimpleListBox::insert( const QString& text, int index )
 {
-    if ( m_data->columnWidthHint <= 0.0 )
-    {
-        const auto w = qskHorizontalAdvance( effectiveFont( Cell ), text );
-        if ( w > m_data->maxTextWidth )
-            m_data->maxTextWidth = w;
-    }
-
-    if ( index < 0 )
-        m_data->entries.append( text );
-    else
-        m_data->entries.insert( index, text );
-
-    propagateEntries();
+    insert( QStringList( text ), index );
 }
 
 void QskSimpleListBox::removeAt( int index )
@@ -167,16 +216,7 @@ void QskSimpleListBox::removeAt( int index )
     if ( index < 0 || index >= entries.size() )
         return;
 
-    if ( m_data->columnWidthHint <= 0.0 )
-    {
-        const auto w = qskHorizontalAdvance( effectiveFont( Cell ), entries[ index ] );
-        if ( w >= m_data->maxTextWidth )
-            m_data->maxTextWidth = qskMaxWidth( effectiveFont( Text ), entries );
-    }
-    else
-    {
-        entries.removeAt( index );
-    }
+    m_data->removeEntries( index, index );
 
     propagateEntries();
 
@@ -203,11 +243,7 @@ void QskSimpleListBox::removeBulk( int from, int to )
     if ( to < from )
         return;
 
-    for ( int i = to; i >= from; i-- )
-        m_data->entries.removeAt( i );
-
-    if ( m_data->columnWidthHint <= 0.0 )
-        m_data->maxTextWidth = qskMaxWidth( effectiveFont( Text ), m_data->entries );
+    m_data->removeEntries( from, to );
 
     propagateEntries();
 
@@ -244,15 +280,124 @@ void QskSimpleListBox::clear()
     if ( m_data->entries.isEmpty() )
         return;
 
-    m_data->entries.clear();
-
-    if ( m_data->columnWidthHint <= 0.0 )
-        m_data->maxTextWidth = 0.0;
+    m_data->removeEntries( 0, m_data->entries.size() - 1 );
 
     propagateEntries();
     setSelectedRow( -1 );
 }
 
+void QskSimpleListBox::changeEvent( QEvent* event )
+{
+    if ( event->type() == QEvent::StyleChange )
+    {
+        // the font might have changed
+        if ( !m_data->entries.isEmpty() )
+        {
+            m_data->invalidateWidths();
+            measureWidths();
+        }
+    }
+
+    Inherited::changeEvent( event );
+}
+
+void QskSimpleListBox::measureWidths()
+{
+    // measuring all entries without a width
+
+    if ( m_data->columnWidthHint > 0.0 || m_data->isMeasuring )
+        return;
+
+    QVector< int > rows;
+    QStringList texts;
+
+    const auto& widths = m_data->widths;
+    for ( int row = 0; row < widths.size(); row++ )
+    {
+        if ( widths[ row ] < 0.0 )
+        {
+            rows += row;
+            texts += m_data->entries[ row ];
+        }
+    }
+
+    if ( rows.isEmpty() )
+        return;
+
+    const auto font = effectiveFont( Text );
+
+    if ( rows.size() < qskAsyncMeasureCount )
+    {
+        const QFontMetricsF fm( font );
+
+        for ( int i = 0; i < rows.size(); i++ )
+            m_data->setWidth( rows[ i ], qskHorizontalAdvance( fm, texts[ i ] ) );
+
+        return;
+    }
+
+    m_data->isMeasuring = true;
+
+    const int generation = m_data->generation;
+    const QPointer< QskSimpleListBox > box( this );
+
+    auto runnable = QRunnable::create(
+        [ box, generation, rows, texts, font ]()
+        {
+            const QFontMetricsF fm( font );
+
+            QVector< qreal > widths;
+            widths.reserve( texts.size() );
+
+            for ( const auto& text : texts )
+                widths += qskHorizontalAdvance( fm, text );
+
+            // back to the GUI thread, where the box might have been deleted
+            QMetaObject::invokeMethod( qApp,
+                [ box, generation, rows, texts, widths ]()
+                {
+                    if ( box )
+                        box->setMeasuredWidths( generation, rows, texts, widths );
+                },
+                Qt::QueuedConnection );
+        }
+    );
+
+    QThreadPool::globalInstance()->start( runnable );
+}
+
+void QskSimpleListBox::setMeasuredWidths( int generation, const QVector< int >& rows,
+    const QStringList& texts, const QVector< qreal >& widths )
+{
+    m_data->isMeasuring = false;
+
+    if ( generation == m_data->generation )
+    {
+        const auto& entries = m_data->entries;
+
+        for ( int i = 0; i < rows.size(); i++ )
+        {
+            /*
+                The entries might have been modified in the meantime,
+                but as long as the text is the same the width is valid.
+             */
+            const auto row = rows[ i ];
+
+            if ( row < entries.size() && m_data->widths[ row ] < 0.0
+                && entries[ row ] == texts[ i ] )
+            {
+                m_data->setWidth( row, widths[ i ] );
+            }
+        }
+    }
+
+    // entries, that have been inserted or shifted in the meantime
+    measureWidths();
+
+    updateScrollableSize();
+    update();
+}
+
 void QskSimpleListBox::propagateEntries()
 {
 #if 1
@@ -279,8 +424,11 @@ qreal QskSimpleListBox::columnWidth( int col ) const
     if ( col >= columnCount() )
         return 0.0;
 
+    const auto w = ( m_data->columnWidthHint > 0.0 )
+        ? m_data->columnWidthHint : m_data->maxTextWidth();
+
     const auto padding = paddingHint( Cell );
-    return m_data->maxTextWidth + padding.left() + padding.right();
+    return w + padding.left() + padding.right();
 }
 
 qreal QskSimpleListBox::rowHeight() const
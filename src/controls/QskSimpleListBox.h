@@ -8,6 +8,7 @@
 
 #include "QskListView.h"
 #include <qstringlist.h>
+#include <qvector.h>
 
 class QSK_EXPORT QskSimpleListBox : public QskListView
 {
@@ -57,9 +58,16 @@ class QSK_EXPORT QskSimpleListBox : public QskListView
     void entriesChanged();
     void selectedEntryChanged( const QString& );
 
+  protected:
+    void changeEvent( QEvent* ) override;
+
   private:
     void propagateEntries();
 
+    void measureWidths();
+    void setMeasuredWidths( int generation, const QVector< int >& rows,
+        const QStringList& texts, const QVector< qreal >& widths );
+
     class PrivateData;
     std::unique_ptr< PrivateData > m_data;
 };
@@ -67,12 +67,32 @@ static inline QRectF qskSubControlRect( const QskSkinlet* skinlet,
     if ( auto control = skinnable->controlCast() )
     {
         const auto r = control->contentsRect();
+
+        // going through the skinnable to make use of its cached rects
+        if ( skinlet == skinnable->effectiveSkinlet() )
+            return skinnable->subControlRect( r, subControl );
+
         return skinlet->subControlRect( skinnable, r, subControl );
     }
 
     return QRectF();
 }
 
+static inline bool qskIsNodeRoleDirty( const QskSkinnable* skinnable,
+    const QVector< QskAspect::Subcontrol >& subControls )
+{
+    if ( subControls.isEmpty() )
+        return true;
+
+    for ( const auto subControl : subControls )
+    {
+        if ( skinnable->isSubcontrolDirty( subControl ) )
+            return true;
+    }
+
+    return false;
+}
+
 static inline QSGNode* qskUpdateTextNode( const QskSkinnable* skinnable,
     QSGNode* node, const QRectF& rect, Qt::Alignment alignment,
     const QString& text, const QFont& font, const QskTextOptions& textOptions,
@@ -282,6 +302,9 @@ class QskSkinlet::PrivateData
     QskSkin* skin;
     QVector< quint8 > nodeRoles;
 
+    // indexed by node role
+    QVector< QVector< QskAspect::Subcontrol > > nodeRoleSubcontrols;
+
     bool ownedBySkinnable : 1;
 };
 
@@ -324,6 +347,22 @@ const QVector< quint8 >& QskSkinlet::nodeRoles() const
     return m_data->nodeRoles;
 }
 
+void QskSkinlet::setNodeRoleSubcontrols( quint8 nodeRole,
+    const QVector< QskAspect::Subcontrol >& subControls )
+{
+    auto& roleSubcontrols = m_data->nodeRoleSubcontrols;
+
+    if ( nodeRole >= roleSubcontrols.size() )
+        roleSubcontrols.resize( nodeRole + 1 );
+
+    roleSubcontrols[ nodeRole ] = subControls;
+}
+
+QVector< QskAspect::Subcontrol > QskSkinlet::nodeRoleSubcontrols( quint8 nodeRole ) const
+{
+    return m_data->nodeRoleSubcontrols.value( nodeRole );
+}
+
 void QskSkinlet::updateNode( QskSkinnable* skinnable, QSGNode* parentNode ) const
 {
     using namespace QskSGNode;
@@ -351,15 +390,25 @@ void QskSkinlet::updateNode( QskSkinnable* skinnable, QSGNode* parentNode ) cons
         replaceChildNode( DebugRole, parentNode, oldNode, newNode );
     }
 
+    const auto& roleSubcontrols = m_data->nodeRoleSubcontrols;
+
     for ( const auto nodeRole : std::as_const( m_data->nodeRoles ) )
     {
         Q_ASSERT( nodeRole < FirstReservedRole );
 
+        if ( nodeRole < roleSubcontrols.size() )
+        {
+            if ( !qskIsNodeRoleDirty( skinnable, roleSubcontrols[ nodeRole ] ) )
+                continue;
+        }
+
         oldNode = QskSGNode::findChildNode( parentNode, nodeRole );
         newNode = updateSubNode( skinnable, nodeRole, oldNode );
 
         replaceChildNode( nodeRole, parentNode, oldNode, newNode );
     }
+
+    skinnable->resetDirtySubcontrols();
 }
 
 QSGNode* QskSkinlet::updateBackgroundNode(
@@ -765,13 +814,18 @@ int QskSkinlet::sampleIndexAt( const QskSkinnable* skinnable,
 
 QSGNode* QskSkinlet::updateSeriesNode( const QskSkinnable* skinnable,
     QskAspect::Subcontrol subControl, QSGNode* rootNode ) const
+{
+    const auto count = sampleCount( skinnable, subControl );
+    return updateSeriesNode( skinnable, subControl, 0, count, rootNode );
+}
+
+QSGNode* QskSkinlet::updateSeriesNode( const QskSkinnable* skinnable,
+    QskAspect::Subcontrol subControl, int from, int to, QSGNode* rootNode ) const
 {
     auto node = rootNode ? rootNode->firstChild() : nullptr;
     QSGNode* lastNode = nullptr;
 
-    const auto count = sampleCount( skinnable, subControl );
-
-    for( int i = 0; i < count; i++ )
+    for( int i = qMax( from, 0 ); i < to; i++ )
     {
         QSGNode* newNode = nullptr;
 
@@ -805,7 +859,10 @@ QSGNode* QskSkinlet::updateSeriesNode( const QskSkinnable* skinnable,
         }
     }
 
-    QskSGNode::removeAllChildNodesAfter( rootNode, lastNode );
+    if ( lastNode )
+        QskSGNode::removeAllChildNodesAfter( rootNode, lastNode );
+    else if ( rootNode )
+        QskSGNode::removeAllChildNodesFrom( rootNode, rootNode->firstChild() );
 
     return rootNode;
 }
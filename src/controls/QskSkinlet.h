@@ -137,6 +137,17 @@ class QSK_EXPORT QskSkinlet
     void setNodeRoles( const QVector< quint8 >& );
     void appendNodeRoles( const QVector< quint8 >& );
 
+    /*
+        Declaring the subcontrols a node role depends on allows
+        to skip updating the node as long as none of them has been
+        marked dirty ( see QskSkinnable::isSubcontrolDirty ).
+        Roles without subcontrols are always updated.
+     */
+    void setNodeRoleSubcontrols( quint8 nodeRole,
+        const QVector< QskAspect::Subcontrol >& );
+
+    QVector< QskAspect::Subcontrol > nodeRoleSubcontrols( quint8 nodeRole ) const;
+
     virtual QSGNode* updateSubNode( const QskSkinnable*,
         quint8 nodeRole, QSGNode* ) const;
 
@@ -172,6 +183,14 @@ class QSK_EXPORT QskSkinlet
     QSGNode* updateSeriesNode( const QskSkinnable*,
         QskAspect::Subcontrol, QSGNode* ) const;
 
+    /*
+        Updating the nodes for the samples [from, to[ only - f.e the
+        visible ones. The child nodes are recycled in order of
+        their position, no matter which sample they had been used for.
+     */
+    QSGNode* updateSeriesNode( const QskSkinnable*,
+        QskAspect::Subcontrol, int from, int to, QSGNode* ) const;
+
     virtual QSGNode* updateSampleNode( const QskSkinnable*,
         QskAspect::Subcontrol, int index, QSGNode* ) const;
 
@@ -31,8 +31,13 @@
 
 #include <qfont.h>
 #include <qfontmetrics.h>
+#include <qvarlengtharray.h>
 #include <map>
 
+QSK_QT_PRIVATE_BEGIN
+#include <private/qquickitem_p.h>
+QSK_QT_PRIVATE_END
+
 #define DEBUG_MAP 0
 #define DEBUG_ANIMATOR 0
 #define DEBUG_STATE 0
@@ -132,7 +137,20 @@ static inline constexpr QskAspect qskAnimatorAspect( const QskAspect aspect )
     return aspect.type() | aspect.subControl() | aspect.primitive(); 
 }
 
-static inline void qskTriggerUpdates( QskAspect aspect, QQuickItem* item )
+static inline bool qskIsNarrowable( const QQuickItem* item )
+{
+    /*
+        Limiting an update to the nodes of some subcontrols relies on
+        QskDirtyItemFilter detecting all other update requests. It is
+        installed for the windows of items with QskQuickItem::DeferredUpdate.
+     */
+    auto qskItem = qobject_cast< const QskQuickItem* >( item );
+
+    return qskItem && qskItem->window()
+        && qskItem->testUpdateFlag( QskQuickItem::DeferredUpdate );
+}
+
+static inline void qskTriggerUpdates( QskAspect aspect, QskSkinnable* skinnable )
 {
     /*
         To put the hint into effect we have to call the usual suspects:
@@ -148,10 +166,19 @@ static inline void qskTriggerUpdates( QskAspect aspect, QQuickItem* item )
         controls.
      */
 
+    auto item = skinnable->owningItem();
+
     if ( item == nullptr || aspect.isAnimator() )
         return;
 
-    item->update(); // always
+    /*
+        Colors do not have an impact on the geometry of other subcontrols,
+        so we can limit the update to the nodes depending on it.
+     */
+    if ( aspect.isColor() )
+        skinnable->markSubcontrolDirty( aspect.subControl() );
+    else
+        skinnable->markSubcontrolDirty( QskAspect::NoSubcontrol );
 
     auto control = qskControlCast( item );
     if ( control == nullptr )
@@ -231,6 +258,19 @@ static inline QskAspect qskSubstitutedAspect(
     return aspect;
 }
 
+namespace
+{
+    class SubcontrolRect
+    {
+      public:
+        QRectF contentsRect;
+        QskAspect::Subcontrol subControl;
+        QRectF rect;
+    };
+
+    using SubcontrolRectCache = QVarLengthArray< SubcontrolRect, 16 >;
+}
+
 class QskSkinnable::PrivateData
 {
   public:
@@ -256,6 +296,14 @@ class QskSkinnable::PrivateData
     const QskSkinlet* skinlet = nullptr;
 
     QskAspect::States skinStates;
+
+    // subcontrols, that have been changed since the last updateNode
+    QVector< QskAspect::Subcontrol > dirtySubcontrols;
+    bool allNodesDirty = false;
+
+    // subcontrol rects, that have been calculated during updateNode
+    SubcontrolRectCache* rectCache = nullptr;
+
     bool hasLocalSkinlet = false;
 };
 
@@ -292,10 +340,9 @@ void QskSkinnable::setSkinlet( const QskSkinlet* skinlet )
             control->resetImplicitSize();
 
         item->polish();
-
-        if ( item->flags() & QQuickItem::ItemHasContents )
-            item->update();
     }
+
+    markSubcontrolDirty( QskAspect::NoSubcontrol );
 }
 
 const QskSkinlet* QskSkinnable::skinlet() const
@@ -899,7 +946,7 @@ bool QskSkinnable::setSkinHint( QskAspect aspect, const QVariant& hint )
 
     if ( m_data->hintTable.setHint( aspect, hint ) )
     {
-        qskTriggerUpdates( aspect, owningItem() );
+        qskTriggerUpdates( aspect, this );
         return true;
     }
 
@@ -912,7 +959,7 @@ bool QskSkinnable::resetSkinHint( QskAspect aspect )
 
     if ( m_data->hintTable.removeHint( aspect ) )
     {
-        qskTriggerUpdates( aspect, owningItem() );
+        qskTriggerUpdates( aspect, this );
         return true;
     }
 
@@ -1263,7 +1310,32 @@ QRectF QskSkinnable::outerBox(
 QRectF QskSkinnable::subControlRect(
     const QRectF& contentsRect, QskAspect::Subcontrol subControl ) const
 {
-    return effectiveSkinlet()->subControlRect( this, contentsRect, subControl );
+    auto cache = m_data->rectCache;
+    if ( cache == nullptr )
+        return effectiveSkinlet()->subControlRect( this, contentsRect, subControl );
+
+    for ( const auto& entry : std::as_const( *cache ) )
+    {
+        if ( entry.subControl == subControl && entry.contentsRect == contentsRect )
+            return entry.rect;
+    }
+
+    const auto rect = effectiveSkinlet()->subControlRect( this, contentsRect, subControl );
+
+    /*
+        The skinlet might have run into invalidating the cache,
+        so we have to check it again
+     */
+    if ( m_data->rectCache )
+        m_data->rectCache->append( { contentsRect, subControl, rect } );
+
+    return rect;
+}
+
+void QskSkinnable::invalidateSubcontrolRects()
+{
+    if ( m_data->rectCache )
+        m_data->rectCache->clear();
 }
 
 QRectF QskSkinnable::subControlContentsRect(
@@ -1367,6 +1439,8 @@ void QskSkinnable::replaceSkinStates(
 
     m_data->skinStates = newStates;
     m_data->sampleIndex = sampleIndex; // needed to find specific animators
+
+    invalidateSubcontrolRects();
 }
 
 void QskSkinnable::addSkinStates( QskAspect::States states )
@@ -1410,11 +1484,11 @@ void QskSkinnable::setSkinStates( QskAspect::States newStates )
             }
         }
 
-        if ( item->flags() & QQuickItem::ItemHasContents )
-            item->update();
+        markSubcontrolDirty( QskAspect::NoSubcontrol );
     }
 
     m_data->skinStates = newStates;
+    invalidateSubcontrolRects();
 }
 
 bool QskSkinnable::startHintTransitions(
@@ -1528,6 +1602,11 @@ QskAspect::Variation QskSkinnable::effectiveVariation() const
     return QskAspect::NoVariation;
 }
 
+int QskSkinnable::effectiveSampleIndex() const
+{
+    return m_data->sampleIndex;
+}
+
 QskAspect::Section QskSkinnable::section() const
 {
     return QskAspect::Body;
@@ -1535,7 +1614,88 @@ QskAspect::Section QskSkinnable::section() const
 
 void QskSkinnable::updateNode( QSGNode* parentNode )
 {
+    /*
+        The same subcontrol rects are usually requested several times,
+        when updating the nodes. As the GUI thread is blocked, while
+        the scene graph is synchronized, the geometry, states and hints
+        can't be changed from outside and we can cache the rects.
+
+        Beyond updateNode the rects depend on all sort of properties,
+        we are not aware of ( f.e. the value of a slider ), so
+        we don't cache them in general.
+     */
+    SubcontrolRectCache cache;
+
+    m_data->rectCache = &cache;
     effectiveSkinlet()->updateNode( this, parentNode );
+    m_data->rectCache = nullptr;
+}
+
+void QskSkinnable::markNodesDirty()
+{
+    m_data->allNodesDirty = true;
+    m_data->dirtySubcontrols.clear();
+
+    invalidateSubcontrolRects();
+}
+
+void QskSkinnable::markSubcontrolDirty( QskAspect::Subcontrol subControl )
+{
+    auto item = owningItem();
+    if ( item && !( item->flags() & QQuickItem::ItemHasContents ) )
+        item = nullptr;
+
+    if ( subControl == QskAspect::NoSubcontrol || !qskIsNarrowable( item ) )
+    {
+        markNodesDirty();
+
+        if ( item )
+            item->update();
+
+        return;
+    }
+
+    if ( !m_data->allNodesDirty )
+    {
+        auto& subControls = m_data->dirtySubcontrols;
+        if ( !subControls.contains( subControl ) )
+            subControls += subControl;
+    }
+
+    invalidateSubcontrolRects();
+
+    if ( item )
+    {
+        /*
+            Any other request - like QQuickItem::update() - sets the
+            Content flag and QskDirtyItemFilter then marks all nodes dirty,
+            before the scene graph gets synchronized. So we use
+            another flag, that also results in calling updatePaintNode.
+         */
+        QQuickItemPrivate::get( item )->dirty( QQuickItemPrivate::Smooth );
+    }
+}
+
+bool QskSkinnable::isSubcontrolDirty( QskAspect::Subcontrol subControl ) const
+{
+    const auto& subControls = m_data->dirtySubcontrols;
+
+    /*
+        Without any information about what has been changed, we have
+        to assume that everything is affected: f.e when the update has
+        been scheduled by QQuickItem::update()
+     */
+    if ( m_data->allNodesDirty || subControls.isEmpty() )
+        return true;
+
+    return subControls.contains( subControl )
+        || subControls.contains( effectiveSubcontrol( subControl ) );
+}
+
+void QskSkinnable::resetDirtySubcontrols()
+{
+    m_data->allNodesDirty = false;
+    m_data->dirtySubcontrols.clear();
 }
 
 QskAspect::Subcontrol QskSkinnable::effectiveSubcontrol(
@@ -265,12 +265,36 @@ class QSK_EXPORT QskSkinnable
 
     const QskHintAnimator* runningHintAnimator( QskAspect, int index = -1 ) const;
 
+    /*
+        Skinlets can skip updating nodes, that depend on subcontrols
+        that have not been changed since the last update cycle
+        ( see QskSkinlet::setNodeRoleSubcontrols ).
+        QskAspect::NoSubcontrol marks all nodes being dirty.
+
+        Only changes of colors can be limited to the nodes of a subcontrol.
+        Other hints might also affect the geometry of other subcontrols.
+
+        Any other update request in the same cycle - f.e. QQuickItem::update() -
+        marks all nodes dirty.
+     */
+    void markSubcontrolDirty( QskAspect::Subcontrol );
+    bool isSubcontrolDirty( QskAspect::Subcontrol ) const;
+
   protected:
     virtual void updateNode( QSGNode* );
+
+    // marking all nodes dirty without scheduling an update
+    void markNodesDirty();
     virtual bool isTransitionAccepted( QskAspect ) const;
 
     virtual QskAspect::Subcontrol substitutedSubcontrol( QskAspect::Subcontrol ) const;
 
+    /*
+        The index of the sample, while its hints are resolved
+        ( see QskSkinlet::updateSeriesNode ), otherwise -1
+     */
+    int effectiveSampleIndex() const;
+
     QskSkinHintTable& hintTable();
 
   private:
@@ -286,6 +310,14 @@ class QSK_EXPORT QskSkinnable
     friend class QskSkinStateChanger;
     void replaceSkinStates( QskAspect::States, int sampleIndex = -1 );
 
+    void invalidateSubcontrolRects();
+
+    friend class QskSkinlet;
+    void resetDirtySubcontrols();
+
+    // calling markNodesDirty, when detecting other update requests
+    friend class QskDirtyItemFilter;
+
     class PrivateData;
     std::unique_ptr< PrivateData > m_data;
 };
@@ -37,6 +37,9 @@ QskSwipeView::QskSwipeView( QQuickItem* parent )
 
     resetSwipeDistance();
     resetDuration();
+
+    // the neighbours need to be ready, when a swipe gesture starts
+    setPreloadDistance( 1 );
 }
 
 QskSwipeView::~QskSwipeView()
@@ -10,9 +10,17 @@
 #include "QskTabButton.h"
 #include "QskTextOptions.h"
 #include "QskAnimationHint.h"
+#include "QskEvent.h"
 #include "QskQuick.h"
 
+#include <qmap.h>
+#include <qpointer.h>
 #include <qquickwindow.h>
+#include <qvector.h>
+
+#include <algorithm>
+#include <functional>
+#include <vector>
 
 QSK_SUBCONTROL( QskTabBar, Panel )
 
@@ -29,6 +37,24 @@ static inline void qskTransposeSizePolicy( QskControl* control )
     control->setSizePolicy( control->sizePolicy().transposed() );
 }
 
+static void qskSetChecked( QskTabButton* button, bool on )
+{
+    if ( on == button->isChecked() )
+        return;
+
+    if ( on )
+    {
+        button->setChecked( true );
+    }
+    else
+    {
+        // exclusive buttons can't be unchecked
+        button->setExclusive( false );
+        button->setChecked( false );
+        button->setExclusive( true );
+    }
+}
+
 namespace
 {
     class ButtonBox final : public QskLinearBox
@@ -61,6 +87,562 @@ namespace
         }
     };
 
+    /*
+        The tabs of a bar with lazy buttons: only the tabs inside of the
+        viewport of the scroll box are represented by buttons, that are
+        recycled when scrolling. The extents of the tabs are measured by
+        a hidden probe button, so that the positions of all tabs are known
+        without instantiating them.
+     */
+    class LazyButtonBox final : public QskControl
+    {
+        using Inherited = QskControl;
+
+      public:
+        using ButtonInitializer = std::function< void( QskTabButton* ) >;
+
+        LazyButtonBox( Qt::Orientation orientation, QQuickItem* parent )
+            : QskControl( parent )
+            , m_orientation( orientation )
+        {
+            setObjectName( QStringLiteral( "QskTabBarLazyBox" ) );
+            initSizePolicy( QskSizePolicy::Maximum, QskSizePolicy::Maximum );
+        }
+
+        void setButtonInitializer( const ButtonInitializer& initializer )
+        {
+            m_initializer = initializer;
+        }
+
+        void setOrientation( Qt::Orientation orientation )
+        {
+            if ( orientation != m_orientation )
+            {
+                m_orientation = orientation;
+                invalidateExtents();
+            }
+        }
+
+        void setSpacing( qreal spacing )
+        {
+            spacing = qMax( spacing, 0.0 );
+
+            if ( spacing != m_spacing )
+            {
+                m_spacing = spacing;
+                invalidate();
+            }
+        }
+
+        int count() const
+        {
+            return m_tabs.count();
+        }
+
+        void insertTab( int index, const QString& text, QskTabButton* button )
+        {
+            Tab tab;
+            tab.text = text;
+
+            if ( button )
+            {
+                // explicitly inserted buttons are never recycled
+                tab.button = button;
+
+                button->setParentItem( this );
+                button->setVisible( false );
+
+                connect( button, &QObject::destroyed,
+                    this, &LazyButtonBox::forgetButton );
+            }
+
+            shiftButtons( index, 1 );
+            m_tabs.insert( index, tab );
+
+            if ( m_currentIndex >= index )
+                m_currentIndex++;
+
+            invalidate();
+        }
+
+        void removeTab( int index )
+        {
+            if ( auto button = m_buttons.take( index ) )
+                releaseButton( index, button );
+
+            const QPointer< QskTabButton > pinnedButton = m_tabs[ index ].button;
+
+            m_tabs.remove( index );
+            shiftButtons( index + 1, -1 );
+
+            if ( m_currentIndex == index )
+                m_currentIndex = -1;
+            else if ( m_currentIndex > index )
+                m_currentIndex--;
+
+            delete pinnedButton;
+
+            invalidate();
+        }
+
+        void clear( bool autoDelete )
+        {
+            for ( auto it = m_buttons.constBegin(); it != m_buttons.constEnd(); ++it )
+                releaseButton( it.key(), it.value() );
+
+            m_buttons.clear();
+
+            for ( const auto& tab : std::as_const( m_tabs ) )
+            {
+                if ( auto button = tab.button.data() )
+                {
+                    if ( autoDelete )
+                    {
+                        delete button;
+                    }
+                    else
+                    {
+                        button->setParentItem( nullptr );
+                        if ( button->parent() == this )
+                            button->setParent( nullptr );
+                    }
+                }
+            }
+
+            m_tabs.clear();
+            m_currentIndex = -1;
+
+            invalidate();
+        }
+
+        QString textAt( int index ) const
+        {
+            if ( index < 0 || index >= m_tabs.count() )
+                return QString();
+
+            const auto& tab = m_tabs[ index ];
+            return tab.button ? tab.button->text() : tab.text;
+        }
+
+        void setTextAt( int index, const QString& text )
+        {
+            if ( index < 0 || index >= m_tabs.count() )
+                return;
+
+            auto& tab = m_tabs[ index ];
+
+            if ( tab.button )
+            {
+                tab.button->setText( text );
+            }
+            else
+            {
+                tab.text = text;
+
+                if ( auto button = buttonAt( index ) )
+                    button->setText( text );
+            }
+
+            tab.hint = QSizeF();
+            invalidate();
+        }
+
+        bool isEnabledAt( int index ) const
+        {
+            if ( index < 0 || index >= m_tabs.count() )
+                return false;
+
+            const auto& tab = m_tabs[ index ];
+            return tab.button ? tab.button->isEnabled() : tab.enabled;
+        }
+
+        void setEnabledAt( int index, bool on )
+        {
+            if ( index < 0 || index >= m_tabs.count() )
+                return;
+
+            auto& tab = m_tabs[ index ];
+            tab.enabled = on;
+
+            if ( auto button = tab.button ? tab.button.data() : buttonAt( index ) )
+                button->setEnabled( on );
+        }
+
+        QskTabButton* buttonAt( int index ) const
+        {
+            return m_buttons.value( index, nullptr );
+        }
+
+        int indexOf( const QskTabButton* button ) const
+        {
+            for ( auto it = m_buttons.constBegin(); it != m_buttons.constEnd(); ++it )
+            {
+                if ( it.value() == button )
+                    return it.key();
+            }
+
+            return -1;
+        }
+
+        QVector< QskTabButton* > buttons() const
+        {
+            // all buttons, including the hidden ones
+            QVector< QskTabButton* > buttons;
+
+            const auto children = childItems();
+            for ( auto child : children )
+            {
+                if ( auto button = qobject_cast< QskTabButton* >( child ) )
+                    buttons += button;
+            }
+
+            return buttons;
+        }
+
+        void setCurrentIndex( int index )
+        {
+            m_currentIndex = index;
+
+            m_isBinding = true;
+
+            const auto buttons = this->buttons();
+            for ( auto button : buttons )
+                qskSetChecked( button, index >= 0 && indexOf( button ) == index );
+
+            m_isBinding = false;
+
+            polish();
+        }
+
+        bool isBinding() const
+        {
+            // the checked states of the buttons are modified internally
+            return m_isBinding;
+        }
+
+        QRectF tabRect( int index ) const
+        {
+            if ( index < 0 || index >= m_tabs.count() )
+                return QRectF();
+
+            updateExtents();
+
+            const auto start = m_starts[ index ];
+            const auto extent = m_starts[ index + 1 ] - start - m_spacing;
+
+            if ( m_orientation == Qt::Horizontal )
+                return QRectF( start, 0.0, extent, height() );
+            else
+                return QRectF( 0.0, start, width(), extent );
+        }
+
+        void invalidateExtents()
+        {
+            for ( auto& tab : m_tabs )
+                tab.hint = QSizeF();
+
+            invalidate();
+        }
+
+      protected:
+        bool event( QEvent* event ) override
+        {
+            if ( static_cast< int >( event->type() ) == QskEvent::ItemLayoutRequest )
+            {
+                /*
+                    The recycled buttons are measured by the probe, but
+                    explicitly inserted buttons might have changed on their own.
+                 */
+                auto requestEvent = static_cast< const QskLayoutRequestEvent* >( event );
+                if ( requestEvent->item() )
+                {
+                    auto button = qobject_cast< const QskTabButton* >( requestEvent->item() );
+
+                    const auto index = indexOf( button );
+                    if ( index >= 0 && m_tabs[ index ].button == button )
+                    {
+                        m_tabs[ index ].hint = QSizeF();
+                        invalidate();
+                    }
+                }
+            }
+
+            return Inherited::event( event );
+        }
+
+        void changeEvent( QEvent* event ) override
+        {
+            switch ( event->type() )
+            {
+                case QEvent::StyleChange:
+                case QEvent::FontChange:
+                case QEvent::LocaleChange:
+                    invalidateExtents();
+                    break;
+
+                default:
+                    break;
+            }
+
+            Inherited::changeEvent( event );
+        }
+
+        void geometryChangeEvent( QskGeometryChangeEvent* event ) override
+        {
+            Inherited::geometryChangeEvent( event );
+
+            // the box is moved, when scrolling
+            polish();
+        }
+
+        void updateLayout() override
+        {
+            updateExtents();
+            updateButtons();
+        }
+
+        QSizeF layoutSizeHint( Qt::SizeHint which, const QSizeF& ) const override
+        {
+            if ( which == Qt::MaximumSize )
+                return QSizeF();
+
+            updateExtents();
+
+            const auto extent = m_tabs.isEmpty()
+                ? 0.0 : m_starts.back() - m_spacing;
+
+            if ( m_orientation == Qt::Horizontal )
+                return QSizeF( extent, m_crossExtent );
+            else
+                return QSizeF( m_crossExtent, extent );
+        }
+
+      private:
+        class Tab
+        {
+          public:
+            QString text;
+            QPointer< QskTabButton > button;
+
+            QSizeF hint; // invalid: not measured yet
+            bool enabled = true;
+        };
+
+        void invalidate()
+        {
+            m_isDirty = true;
+
+            resetImplicitSize();
+            polish();
+        }
+
+        void updateExtents() const
+        {
+            if ( !m_isDirty )
+                return;
+
+            auto that = const_cast< LazyButtonBox* >( this );
+
+            m_starts.resize( m_tabs.count() + 1 );
+            m_starts[ 0 ] = 0.0;
+
+            m_crossExtent = 0.0;
+
+            for ( int i = 0; i < m_tabs.count(); i++ )
+            {
+                auto& tab = that->m_tabs[ i ];
+
+                if ( !tab.hint.isValid() )
+                    tab.hint = that->measuredHint( tab );
+
+                qreal extent, crossExtent;
+
+                if ( m_orientation == Qt::Horizontal )
+                {
+                    extent = tab.hint.width();
+                    crossExtent = tab.hint.height();
+                }
+                else
+                {
+                    extent = tab.hint.height();
+                    crossExtent = tab.hint.width();
+                }
+
+                m_starts[ i + 1 ] = m_starts[ i ] + qMax( extent, 0.0 ) + m_spacing;
+                m_crossExtent = qMax( m_crossExtent, crossExtent );
+            }
+
+            m_isDirty = false;
+        }
+
+        QSizeF measuredHint( const Tab& tab )
+        {
+            if ( tab.button )
+                return tab.button->sizeConstraint();
+
+            if ( m_probe == nullptr )
+            {
+                m_probe = createButton();
+                m_probe->setVisible( false );
+            }
+
+            m_probe->setText( tab.text );
+            return m_probe->sizeConstraint();
+        }
+
+        // the first tab, that ends after pos
+        int tabAt( qreal pos ) const
+        {
+            const auto it = std::upper_bound( m_starts.begin(), m_starts.end(), pos );
+            return qBound( 0, int( it - m_starts.begin() ) - 1, m_tabs.count() - 1 );
+        }
+
+        void updateButtons()
+        {
+            int first = 0;
+            int last = -1;
+
+            if ( !m_tabs.isEmpty() )
+            {
+                auto viewRect = rect();
+
+                if ( auto scrollBox = qobject_cast< const QskScrollBox* >( parentItem() ) )
+                    viewRect &= mapRectFromItem( scrollBox, scrollBox->viewContentsRect() );
+
+                if ( !viewRect.isEmpty() )
+                {
+                    if ( m_orientation == Qt::Horizontal )
+                    {
+                        first = tabAt( viewRect.left() );
+                        last = tabAt( viewRect.right() );
+                    }
+                    else
+                    {
+                        first = tabAt( viewRect.top() );
+                        last = tabAt( viewRect.bottom() );
+                    }
+                }
+            }
+
+            for ( auto it = m_buttons.begin(); it != m_buttons.end(); )
+            {
+                if ( it.key() < first || it.key() > last )
+                {
+                    releaseButton( it.key(), it.value() );
+                    it = m_buttons.erase( it );
+                }
+                else
+                {
+                    ++it;
+                }
+            }
+
+            for ( int i = first; i <= last; i++ )
+            {
+                if ( !m_buttons.contains( i ) )
+                {
+                    if ( auto button = acquireButton( i ) )
+                        m_buttons.insert( i, button );
+                }
+            }
+
+            for ( auto it = m_buttons.constBegin(); it != m_buttons.constEnd(); ++it )
+            {
+                auto button = it.value();
+
+                button->setGeometry( tabRect( it.key() ) );
+                button->setZ( it.key() == m_currentIndex ? 0.001 : 0.0 );
+            }
+        }
+
+        QskTabButton* createButton()
+        {
+            auto button = new QskTabButton( this );
+
+            if ( m_initializer )
+                m_initializer( button );
+
+            return button;
+        }
+
+        QskTabButton* acquireButton( int index )
+        {
+            const auto& tab = m_tabs[ index ];
+
+            QskTabButton* button = tab.button;
+
+            m_isBinding = true;
+
+            if ( button == nullptr )
+            {
+                button = m_pool.isEmpty() ? createButton() : m_pool.takeLast();
+
+                button->setText( tab.text );
+                button->setEnabled( tab.enabled );
+            }
+
+            qskSetChecked( button, index == m_currentIndex );
+
+            m_isBinding = false;
+
+            button->setVisible( true );
+
+            return button;
+        }
+
+        void releaseButton( int index, QskTabButton* button )
+        {
+            button->setVisible( false );
+
+            if ( button != m_tabs[ index ].button )
+                m_pool += button;
+        }
+
+        void forgetButton( const QObject* object )
+        {
+            for ( auto it = m_buttons.begin(); it != m_buttons.end(); ++it )
+            {
+                if ( static_cast< QObject* >( it.value() ) == object )
+                {
+                    m_buttons.erase( it );
+                    break;
+                }
+            }
+        }
+
+        void shiftButtons( int from, int offset )
+        {
+            // the buttons are bound to the indexes of the tabs
+            QMap< int, QskTabButton* > buttons;
+
+            for ( auto it = m_buttons.constBegin(); it != m_buttons.constEnd(); ++it )
+            {
+                const auto index = ( it.key() >= from ) ? it.key() + offset : it.key();
+                buttons.insert( index, it.value() );
+            }
+
+            m_buttons = buttons;
+        }
+
+        Qt::Orientation m_orientation;
+        qreal m_spacing = 0.0;
+
+        QVector< Tab > m_tabs;
+
+        QMap< int, QskTabButton* > m_buttons; // visible tabs
+        QVector< QskTabButton* > m_pool; // recyclable buttons
+        QskTabButton* m_probe = nullptr;
+
+        ButtonInitializer m_initializer;
+
+        mutable std::vector< qreal > m_starts;
+        mutable qreal m_crossExtent = 0.0;
+        mutable bool m_isDirty = true;
+
+        int m_currentIndex = -1;
+        bool m_isBinding = false;
+    };
+
     class ScrollBox final : public QskScrollBox
     {
         using Inherited = QskScrollBox;
@@ -79,6 +661,11 @@ namespace
                 this, &QskControl::focusIndicatorRectChanged );
         }
 
+        void setLazyButtonBox( LazyButtonBox* box )
+        {
+            m_lazyBox = box;
+        }
+
         QRectF focusIndicatorClipRect() const override
         {
             auto r = clipRect();
@@ -197,6 +784,12 @@ namespace
             translateButtonBox();
 
             setClip( width() < boxSize.width() || height() < boxSize.height() );
+
+            if ( m_lazyBox )
+            {
+                // the size of the viewport might have changed
+                m_lazyBox->polish();
+            }
         }
 
         QSizeF layoutSizeHint( Qt::SizeHint which, const QSizeF& constraint ) const override
@@ -217,9 +810,9 @@ namespace
 
       private:
 
-        inline QskLinearBox* buttonBox() const
+        inline QskControl* buttonBox() const
         {
-            return qobject_cast< QskLinearBox* >( childItems().constFirst() );
+            return qskControlCast( childItems().constFirst() );
         }
 
         void enableAutoTranslation( bool on )
@@ -244,6 +837,9 @@ namespace
                 box->setPosition( pos );
             }
         }
+
+        // only set, when having lazy buttons
+        QPointer< LazyButtonBox > m_lazyBox;
     };
 }
 
@@ -264,8 +860,26 @@ class QskTabBar::PrivateData
         }
     }
 
+    QVector< QskTabButton* > buttons() const
+    {
+        if ( lazyBox )
+            return lazyBox->buttons();
+
+        QVector< QskTabButton* > buttons;
+
+        for ( int i = 0; i < buttonBox->elementCount(); i++ )
+        {
+            if ( auto button = qobject_cast< QskTabButton* >( buttonBox->itemAtIndex( i ) ) )
+                buttons += button;
+        }
+
+        return buttons;
+    }
+
     ScrollBox* scrollBox = nullptr;
     ButtonBox* buttonBox = nullptr;
+    LazyButtonBox* lazyBox = nullptr;
+
     int currentIndex = -1;
 
     QskTextOptions textOptions;
@@ -287,12 +901,7 @@ QskTabBar::QskTabBar( QQuickItem* parent )
     m_data->scrollBox = new ScrollBox( this );
     m_data->scrollBox->setOrientation( orientation );
 
-    m_data->buttonBox = new ButtonBox( orientation, m_data->scrollBox );
-    m_data->buttonBox->setSpacing( spacingHint( QskTabBar::Panel ) );
-    m_data->buttonBox->setSizePolicy( QskSizePolicy::Maximum, QskSizePolicy::Maximum );
-
-    connect( this, &QskTabBar::currentIndexChanged,
-        m_data->buttonBox, &ButtonBox::restack, Qt::QueuedConnection );
+    createButtonBox( false );
 }
 
 QskTabBar::QskTabBar( Qt::Edge edge, QQuickItem* parent )
@@ -305,6 +914,72 @@ QskTabBar::~QskTabBar()
 {
 }
 
+void QskTabBar::createButtonBox( bool lazy )
+{
+    const auto orientation = qskOrientation( edge() );
+
+    if ( lazy )
+    {
+        m_data->lazyBox = new LazyButtonBox( orientation, m_data->scrollBox );
+        m_data->lazyBox->setSpacing( spacingHint( QskTabBar::Panel ) );
+
+        m_data->lazyBox->setButtonInitializer(
+            [ this ]( QskTabButton* button ) { initButton( button ); } );
+
+        m_data->scrollBox->setLazyButtonBox( m_data->lazyBox );
+    }
+    else
+    {
+        m_data->buttonBox = new ButtonBox( orientation, m_data->scrollBox );
+        m_data->buttonBox->setSpacing( spacingHint( QskTabBar::Panel ) );
+        m_data->buttonBox->setSizePolicy( QskSizePolicy::Maximum, QskSizePolicy::Maximum );
+
+        connect( this, &QskTabBar::currentIndexChanged,
+            m_data->buttonBox, &ButtonBox::restack, Qt::QueuedConnection );
+    }
+}
+
+void QskTabBar::initButton( QskTabButton* button )
+{
+    if ( button->textOptions() != m_data->textOptions )
+        button->setTextOptions( m_data->textOptions );
+
+    m_data->connectButton( button, this, true );
+
+    connect( button, &QskAbstractButton::clicked,
+        this, &QskTabBar::handleButtonClick, Qt::UniqueConnection );
+}
+
+void QskTabBar::setLazyButtons( bool on )
+{
+    if ( on == hasLazyButtons() )
+        return;
+
+    if ( count() > 0 )
+    {
+        qWarning( "QskTabBar::setLazyButtons: can't be changed, when having tabs" );
+        return;
+    }
+
+    delete m_data->buttonBox;
+    m_data->buttonBox = nullptr;
+
+    delete m_data->lazyBox;
+    m_data->lazyBox = nullptr;
+
+    createButtonBox( on );
+
+    m_data->scrollBox->resetImplicitSize();
+    m_data->scrollBox->polish();
+
+    Q_EMIT lazyButtonsChanged( on );
+}
+
+bool QskTabBar::hasLazyButtons() const
+{
+    return m_data->lazyBox != nullptr;
+}
+
 void QskTabBar::setEdge( Qt::Edge edge )
 {
     const auto oldEdge = this->edge();
@@ -316,20 +991,32 @@ void QskTabBar::setEdge( Qt::Edge edge )
 
     const auto orientation = qskOrientation( edge );
 
-    if ( orientation != m_data->buttonBox->orientation() )
+    if ( orientation != qskOrientation( oldEdge ) )
     {
         qskTransposeSizePolicy( this );
 
-        m_data->buttonBox->setOrientation( orientation );
-        qskTransposeSizePolicy( m_data->buttonBox );
+        if ( auto lazyBox = m_data->lazyBox )
+        {
+            lazyBox->setOrientation( orientation );
+        }
+        else
+        {
+            m_data->buttonBox->setOrientation( orientation );
+            qskTransposeSizePolicy( m_data->buttonBox );
+        }
 
         m_data->scrollBox->setOrientation( orientation );
     }
 
     resetImplicitSize();
 
-    for ( int i = 0; i < count(); i++ )
-        buttonAt( i )->update();
+    const auto buttons = m_data->buttons();
+    for ( auto button : buttons )
+        button->update();
+
+    // the size hints of the buttons depend on the edge
+    if ( m_data->lazyBox )
+        m_data->lazyBox->invalidateExtents();
 
     Q_EMIT edgeChanged( edge );
 }
@@ -371,6 +1058,12 @@ bool QskTabBar::autoScrollFocusButton() const
 
 void QskTabBar::setAutoFitTabs( bool on )
 {
+    if ( m_data->lazyBox )
+    {
+        // not supported for lazy buttons
+        return;
+    }
+
     const auto orientation = qskOrientation( edge() );
     int policy = m_data->buttonBox->sizePolicy( orientation );
 
@@ -393,6 +1086,9 @@ void QskTabBar::setAutoFitTabs( bool on )
 
 bool QskTabBar::autoFitTabs() const
 {
+    if ( m_data->lazyBox )
+        return false;
+
     const auto policy = m_data->buttonBox->sizePolicy( orientation() );
     return ( policy & QskSizePolicy::GrowFlag );
 }
@@ -407,8 +1103,12 @@ void QskTabBar::setTextOptions( const QskTextOptions& options )
         m_data->textOptions = options;
         Q_EMIT textOptionsChanged( options );
 
-        for ( int i = 0; i < count(); i++ )
-            buttonAt( i )->setTextOptions( options );
+        const auto buttons = m_data->buttons();
+        for ( auto button : buttons )
+            button->setTextOptions( options );
+
+        if ( m_data->lazyBox )
+            m_data->lazyBox->invalidateExtents();
     }
 }
 
@@ -424,6 +1124,30 @@ int QskTabBar::addTab( const QString& text )
 
 int QskTabBar::insertTab( int index, const QString& text )
 {
+    if ( auto lazyBox = m_data->lazyBox )
+    {
+        if ( index < 0 || index >= lazyBox->count() )
+            index = lazyBox->count();
+
+        lazyBox->insertTab( index, text, nullptr );
+
+        if ( isComponentComplete() && lazyBox->count() == 1 )
+        {
+            m_data->currentIndex = 0;
+            lazyBox->setCurrentIndex( 0 );
+        }
+        else if ( index <= m_data->currentIndex )
+        {
+            // the current tab has been shifted
+            m_data->currentIndex++;
+            Q_EMIT currentIndexChanged( m_data->currentIndex );
+        }
+
+        Q_EMIT countChanged( count() );
+
+        return index;
+    }
+
     return insertTab( index, new QskTabButton( text ) );
 }
 
@@ -434,6 +1158,30 @@ int QskTabBar::addTab( QskTabButton* button )
 
 int QskTabBar::insertTab( int index, QskTabButton* button )
 {
+    if ( auto lazyBox = m_data->lazyBox )
+    {
+        if ( index < 0 || index >= lazyBox->count() )
+            index = lazyBox->count();
+
+        initButton( button );
+        lazyBox->insertTab( index, QString(), button );
+
+        if ( isComponentComplete() && lazyBox->count() == 1 )
+        {
+            m_data->currentIndex = 0;
+            lazyBox->setCurrentIndex( 0 );
+        }
+        else if ( index <= m_data->currentIndex )
+        {
+            m_data->currentIndex++;
+            Q_EMIT currentIndexChanged( m_data->currentIndex );
+        }
+
+        Q_EMIT countChanged( count() );
+
+        return index;
+    }
+
     auto buttonBox = m_data->buttonBox;
 
     if ( index < 0 || index >= buttonBox->elementCount() )
@@ -451,13 +1199,7 @@ int QskTabBar::insertTab( int index, QskTabButton* button )
     buttonBox->insertItem( index, button );
     buttonBox->restack( m_data->currentIndex );
 
-    if ( button->textOptions() != m_data->textOptions )
-        button->setTextOptions( m_data->textOptions );
-
-    m_data->connectButton( button, this, true );
-
-    connect( button, &QskAbstractButton::clicked,
-        this, &QskTabBar::handleButtonClick );
+    initButton( button );
 
     Q_EMIT countChanged( count() );
 
@@ -466,11 +1208,21 @@ int QskTabBar::insertTab( int index, QskTabButton* button )
 
 void QskTabBar::removeTab( int index )
 {
-    auto item = m_data->buttonBox->itemAtIndex( index );
-    if ( item == nullptr )
-        return;
+    if ( auto lazyBox = m_data->lazyBox )
+    {
+        if ( index < 0 || index >= lazyBox->count() )
+            return;
 
-    delete item;
+        lazyBox->removeTab( index );
+    }
+    else
+    {
+        auto item = m_data->buttonBox->itemAtIndex( index );
+        if ( item == nullptr )
+            return;
+
+        delete item;
+    }
 
     if ( index > m_data->currentIndex )
     {
@@ -485,37 +1237,34 @@ void QskTabBar::removeTab( int index )
     }
     else
     {
-        QskTabButton* nextButton = nullptr;
         int nextIndex = -1;
 
         for ( int i = m_data->currentIndex; i >= 0; i-- )
         {
-            auto button = buttonAt( i );
-            if ( button && button->isEnabled() )
+            if ( i < count() && isTabEnabled( i ) )
             {
-                nextButton = button;
                 nextIndex = i;
-
                 break;
             }
         }
 
-        if ( nextButton == nullptr )
+        if ( nextIndex < 0 )
         {
             for ( int i = m_data->currentIndex + 1; i < count(); i++ )
             {
-                auto button = buttonAt( i );
-                if ( button && button->isEnabled() )
+                if ( isTabEnabled( i ) )
                 {
-                    nextButton = button;
                     nextIndex = i;
-
                     break;
                 }
             }
         }
 
-        if ( nextButton )
+        if ( m_data->lazyBox )
+        {
+            m_data->lazyBox->setCurrentIndex( nextIndex );
+        }
+        else if ( auto nextButton = buttonAt( nextIndex ) )
         {
             m_data->connectButton( nextButton, this, false );
             nextButton->setChecked( true );
@@ -535,7 +1284,13 @@ void QskTabBar::clear( bool autoDelete )
         return;
 
     const int idx = currentIndex();
-    m_data->buttonBox->clear( autoDelete );
+
+    if ( m_data->lazyBox )
+        m_data->lazyBox->clear( autoDelete );
+    else
+        m_data->buttonBox->clear( autoDelete );
+
+    m_data->currentIndex = -1;
 
     Q_EMIT countChanged( count() );
 
@@ -545,13 +1300,20 @@ void QskTabBar::clear( bool autoDelete )
 
 bool QskTabBar::isTabEnabled( int index ) const
 {
+    if ( m_data->lazyBox )
+        return m_data->lazyBox->isEnabledAt( index );
+
     const auto button = buttonAt( index );
     return button ? button->isEnabled() : false;
 }
 
 void QskTabBar::setTabEnabled( int index, bool enabled )
 {
-    if ( auto button = buttonAt( index ) )
+    if ( m_data->lazyBox )
+    {
+        m_data->lazyBox->setEnabledAt( index, enabled );
+    }
+    else if ( auto button = buttonAt( index ) )
     {
         // what happens, when it is the current button ???
         button->setEnabled( enabled );
@@ -564,9 +1326,22 @@ void QskTabBar::setCurrentIndex( int index )
     {
         if ( isComponentComplete() )
         {
-            auto button = buttonAt( index );
-            if ( button && button->isEnabled() && !button->isChecked() )
-                button->setChecked( true );
+            if ( auto lazyBox = m_data->lazyBox )
+            {
+                if ( lazyBox->isEnabledAt( index ) )
+                {
+                    m_data->currentIndex = index;
+                    lazyBox->setCurrentIndex( index );
+
+                    Q_EMIT currentIndexChanged( index );
+                }
+            }
+            else
+            {
+                auto button = buttonAt( index );
+                if ( button && button->isEnabled() && !button->isChecked() )
+                    button->setChecked( true );
+            }
         }
         else
         {
@@ -583,11 +1358,17 @@ int QskTabBar::currentIndex() const
 
 int QskTabBar::count() const
 {
+    if ( m_data->lazyBox )
+        return m_data->lazyBox->count();
+
     return m_data->buttonBox->elementCount();
 }
 
 QskTabButton* QskTabBar::buttonAt( int position )
 {
+    if ( m_data->lazyBox )
+        return m_data->lazyBox->buttonAt( position );
+
     return qobject_cast< QskTabButton* >(
         m_data->buttonBox->itemAtIndex( position ) );
 }
@@ -615,14 +1396,28 @@ QString QskTabBar::currentButtonText() const
 
 QString QskTabBar::buttonTextAt( int index ) const
 {
+    if ( m_data->lazyBox )
+        return m_data->lazyBox->textAt( index );
+
     if ( const auto button = buttonAt( index ) )
         return button->text();
 
     return QString();
 }
 
+void QskTabBar::setButtonTextAt( int index, const QString& text )
+{
+    if ( m_data->lazyBox )
+        m_data->lazyBox->setTextAt( index, text );
+    else if ( auto button = buttonAt( index ) )
+        button->setText( text );
+}
+
 int QskTabBar::indexOf( QskTabButton* button ) const
 {
+    if ( m_data->lazyBox )
+        return m_data->lazyBox->indexOf( button );
+
     return m_data->buttonBox->indexOf( button );
 }
 
@@ -631,6 +1426,21 @@ void QskTabBar::ensureButtonVisible( const QskTabButton* button )
     m_data->scrollBox->ensureItemVisible( button );
 }
 
+void QskTabBar::ensureTabVisible( int index )
+{
+    if ( m_data->lazyBox )
+    {
+        // the box is translated by the scroll position
+        const auto rect = m_data->lazyBox->tabRect( index );
+        if ( !rect.isEmpty() )
+            m_data->scrollBox->ensureVisible( rect );
+    }
+    else
+    {
+        ensureButtonVisible( buttonAt( index ) );
+    }
+}
+
 void QskTabBar::componentComplete()
 {
     Inherited::componentComplete();
@@ -638,7 +1448,11 @@ void QskTabBar::componentComplete()
     if ( m_data->currentIndex < 0 && count() >= 0 )
         m_data->currentIndex = 0;
 
-    if ( auto button = buttonAt( m_data->currentIndex ) )
+    if ( m_data->lazyBox )
+    {
+        m_data->lazyBox->setCurrentIndex( m_data->currentIndex );
+    }
+    else if ( auto button = buttonAt( m_data->currentIndex ) )
     {
         if ( button->isEnabled() && !button->isChecked() )
             button->setChecked( true );
@@ -649,14 +1463,36 @@ void QskTabBar::adjustCurrentIndex()
 {
     int index = -1;
 
-    for ( int i = 0; i < count(); i++ )
+    if ( auto lazyBox = m_data->lazyBox )
     {
-        if ( auto button = buttonAt( i ) )
+        if ( lazyBox->isBinding() )
+            return;
+
+        /*
+            The current tab might not have a button, so we can't
+            conclude from having no checked button.
+         */
+        const auto button = qobject_cast< const QskTabButton* >( sender() );
+        if ( button == nullptr || !button->isChecked() )
+            return;
+
+        index = lazyBox->indexOf( button );
+        if ( index < 0 )
+            return;
+
+        lazyBox->setCurrentIndex( index );
+    }
+    else
+    {
+        for ( int i = 0; i < count(); i++ )
         {
-            if ( button->isChecked() )
+            if ( auto button = buttonAt( i ) )
             {
-                index = i;
-                break;
+                if ( button->isChecked() )
+                {
+                    index = i;
+                    break;
+                }
             }
         }
     }
@@ -27,6 +27,9 @@ class QSK_EXPORT QskTabBar : public QskBox
     Q_PROPERTY( bool autoFitTabs READ autoFitTabs
         WRITE setAutoFitTabs NOTIFY autoFitTabsChanged FINAL )
 
+    Q_PROPERTY( bool lazyButtons READ hasLazyButtons
+        WRITE setLazyButtons NOTIFY lazyButtonsChanged FINAL )
+
     Q_PROPERTY( int count READ count NOTIFY countChanged FINAL )
 
     Q_PROPERTY( int currentIndex READ currentIndex
@@ -57,7 +60,21 @@ class QSK_EXPORT QskTabBar : public QskBox
     void setAutoFitTabs( bool );
     bool autoFitTabs() const;
 
+    /*
+        With lazy buttons the tabs are stored as lightweight entries and
+        buttons exist only for the tabs in the visible part of the bar.
+        They are recycled when scrolling: buttonAt() returns nullptr for
+        all other tabs and a button might represent a different tab later.
+
+        Buttons that are inserted explicitly are never recycled, but hidden
+        while being outside of the visible part. autoFitTabs is not supported
+        and the mode can't be changed as long as the bar has tabs.
+     */
+    void setLazyButtons( bool );
+    bool hasLazyButtons() const;
+
     void ensureButtonVisible( const QskTabButton* );
+    void ensureTabVisible( int index );
 
     void setTextOptions( const QskTextOptions& );
     QskTextOptions textOptions() const;
@@ -85,6 +102,7 @@ class QSK_EXPORT QskTabBar : public QskBox
 
     Q_INVOKABLE QString currentButtonText() const;
     Q_INVOKABLE QString buttonTextAt( int index ) const;
+    Q_INVOKABLE void setButtonTextAt( int index, const QString& );
 
     int indexOf( const QskTabButton* ) const;
     Q_INVOKABLE int indexOf( QskTabButton* ) const;
@@ -102,6 +120,7 @@ class QSK_EXPORT QskTabBar : public QskBox
     void edgeChanged( Qt::Edge );
     void autoScrollFocusedButtonChanged( bool );
     void autoFitTabsChanged( bool );
+    void lazyButtonsChanged( bool );
 
   protected:
     void componentComplete() override;
@@ -110,6 +129,9 @@ class QSK_EXPORT QskTabBar : public QskBox
         QskAspect::Subcontrol ) const override;
 
   private:
+    void initButton( QskTabButton* );
+    void createButtonBox( bool lazy );
+
     void adjustCurrentIndex();
     void handleButtonClick();
 
@@ -59,6 +59,9 @@ QskTabView::QskTabView( QQuickItem* parent )
     connect( m_data->tabBar, &QskTabBar::currentIndexChanged,
         this, &QskTabView::currentIndexChanged );
 
+    connect( m_data->stackBox, &QskStackBox::pageLoaded,
+        this, &QskTabView::initPage );
+
     connect( m_data->tabBar, &QskTabBar::countChanged,
         this, &QskTabView::countChanged );
 
@@ -115,12 +118,34 @@ int QskTabView::addTab( const QString& text, QQuickItem* page )
 
 int QskTabView::insertTab( int index, const QString& text, QQuickItem* page )
 {
-    index = m_data->tabBar->insertTab( index, text );
+    if ( index < 0 || index > count() )
+        index = count();
 
     if ( page && page->parent() == nullptr )
         page->setParent( this );
 
+    /*
+        The page has to be inserted first as a tab bar with lazy buttons
+        shifts its current index, when inserting in front of it.
+     */
     m_data->stackBox->insertItem( index, page );
+    m_data->tabBar->insertTab( index, text );
+
+    return index;
+}
+
+int QskTabView::addTab( const QString& text, const PageFactory& factory )
+{
+    return insertTab( -1, text, factory );
+}
+
+int QskTabView::insertTab( int index, const QString& text, const PageFactory& factory )
+{
+    if ( index < 0 || index > count() )
+        index = count();
+
+    m_data->stackBox->insertPage( index, factory );
+    m_data->tabBar->insertTab( index, text );
 
     return index;
 }
@@ -167,6 +192,12 @@ bool QskTabView::isTabEnabled( int index ) const
     return m_data->tabBar->isTabEnabled( index );
 }
 
+void QskTabView::initPage( int index, QQuickItem* page )
+{
+    // lazy pages are created after setTabEnabled might have been called
+    page->setEnabled( isTabEnabled( index ) );
+}
+
 QQuickItem* QskTabView::pageAt( int index ) const
 {
     return m_data->stackBox->itemAtIndex( index );
@@ -316,11 +347,14 @@ int QskTabView::addTab( QskTabButton* button, QQuickItem* page )
 
 int QskTabView::insertTab( int index, QskTabButton* button, QQuickItem* page )
 {
+    if ( index < 0 || index > count() )
+        index = count();
+
     if ( page && page->parent() == nullptr )
         page->setParent( this );
 
-    index = m_data->tabBar->insertTab( index, button );
     m_data->stackBox->insertItem( index, page );
+    m_data->tabBar->insertTab( index, button );
 
     return index;
 }
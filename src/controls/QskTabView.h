@@ -9,6 +9,8 @@
 #include "QskControl.h"
 #include "QskNamespace.h"
 
+#include <functional>
+
 class QskTabBar;
 class QskTabButton;
 
@@ -36,6 +38,8 @@ class QSK_EXPORT QskTabView : public QskControl
   public:
     QSK_SUBCONTROLS( TabBar, Page )
 
+    using PageFactory = std::function< QQuickItem*() >;
+
     QskTabView( QQuickItem* parent = nullptr );
     ~QskTabView() override;
 
@@ -53,6 +57,15 @@ class QSK_EXPORT QskTabView : public QskControl
     Q_INVOKABLE int addTab( const QString&, QQuickItem* );
     Q_INVOKABLE int insertTab( int index, const QString&, QQuickItem* );
 
+    /*
+        Pages, that are created by the factory, when being needed for the
+        first time - see QskStackBox::insertPage. Until then pageAt()
+        returns a nullptr. In combination with QskTabBar::setLazyButtons
+        nothing is instantiated for tabs, that are neither visible nor current.
+     */
+    int addTab( const QString&, const PageFactory& );
+    int insertTab( int index, const QString&, const PageFactory& );
+
     Q_INVOKABLE void removeTab( int index );
     Q_INVOKABLE void clear( bool autoDelete = false );
 
@@ -98,6 +111,8 @@ class QSK_EXPORT QskTabView : public QskControl
     QSizeF layoutSizeHint( Qt::SizeHint, const QSizeF& ) const override;
 
   private:
+    void initPage( int index, QQuickItem* );
+
     class PrivateData;
     std::unique_ptr< PrivateData > m_data;
 };
@@ -0,0 +1,634 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) 2016 Uwe Rathmann
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#include "QskVirtualLinearBox.h"
+#include "QskEvent.h"
+#include "QskLinearLayoutEngine.h"
+#include "QskRowExtents.h"
+#include "QskQuick.h"
+
+#include <qmap.h>
+#include <qvector.h>
+
+#include <limits>
+
+namespace
+{
+    /*
+        The scrolled item of the scroll area: its extent in
+        direction of the orientation is the sum of the extents
+        of all rows, while only the instantiated delegates
+        are its children.
+     */
+    class ContentsItem final : public QskControl
+    {
+        using Inherited = QskControl;
+
+      public:
+        ContentsItem( QskVirtualLinearBox* box, QskLayoutEngine2D* engine )
+            : QskControl( box )
+            , m_box( box )
+            , m_engine( engine )
+        {
+            setObjectName( QStringLiteral( "QskVirtualLinearBoxContents" ) );
+        }
+
+        void setExtent( Qt::Orientation orientation, qreal extent )
+        {
+            if ( orientation == Qt::Vertical )
+                initSizePolicy( QskSizePolicy::Preferred, QskSizePolicy::Fixed );
+            else
+                initSizePolicy( QskSizePolicy::Fixed, QskSizePolicy::Preferred );
+
+            if ( orientation != m_orientation || extent != m_extent )
+            {
+                m_orientation = orientation;
+                m_extent = extent;
+
+                resetImplicitSize();
+            }
+        }
+
+      protected:
+        bool event( QEvent* event ) override
+        {
+            const int eventType = event->type();
+
+            if ( eventType == QskEvent::ItemLayoutRequest )
+            {
+                // one of the delegates has changed its size hints
+
+                auto requestEvent = static_cast< const QskLayoutRequestEvent* >( event );
+
+                if ( const auto item = requestEvent->item() )
+                {
+                    m_engine->invalidate( item );
+                    m_box->polish();
+
+                    return true;
+                }
+            }
+            else if ( eventType == QEvent::LayoutRequest )
+            {
+                m_engine->invalidate();
+                m_box->polish();
+            }
+
+            return Inherited::event( event );
+        }
+
+        QSizeF layoutSizeHint( Qt::SizeHint which, const QSizeF& ) const override
+        {
+            if ( which == Qt::MaximumSize )
+                return QSizeF();
+
+            // the size hints of the delegates are not taken into account
+            if ( m_orientation == Qt::Vertical )
+                return QSizeF( -1.0, m_extent );
+            else
+                return QSizeF( m_extent, -1.0 );
+        }
+
+      private:
+        QskVirtualLinearBox* m_box;
+        QskLayoutEngine2D* m_engine;
+
+        Qt::Orientation m_orientation = Qt::Vertical;
+        qreal m_extent = 0.0;
+    };
+}
+
+class QskVirtualLinearBox::PrivateData
+{
+  public:
+    PrivateData( Qt::Orientation orientation )
+        : engine( orientation, std::numeric_limits< uint >::max() )
+    {
+    }
+
+    inline qreal rowStart( int row ) const
+    {
+        return extents.position( row );
+    }
+
+    inline qreal rowEnd( int row ) const
+    {
+        // the positions also include the spacing
+        return extents.position( row + 1 ) - extents.spacing();
+    }
+
+    qreal totalExtent() const
+    {
+        return ( count > 0 ) ? rowEnd( count - 1 ) : 0.0;
+    }
+
+    void estimateRow( int row )
+    {
+        // forgetting about a measured extent
+
+        if ( sizeEstimator )
+            extents.setExtent( row, qMax( sizeEstimator( row ), 0.0 ) );
+        else
+            extents.resetExtent( row );
+    }
+
+    void estimateRows( int from, int to )
+    {
+        /*
+            Without an estimator all rows have the same extent, what
+            does not need any memory. Otherwise we have to store an
+            extent for each row.
+         */
+        if ( sizeEstimator )
+        {
+            for ( int row = from; row < to; row++ )
+                estimateRow( row );
+        }
+    }
+
+    void updateExtents( Qt::Orientation orientation )
+    {
+        updateDefaultExtent( orientation );
+
+        extents.clear();
+        extents.setEstimatedExtent( defaultExtent );
+        extents.setSpacing( engine.spacing( Qt::Horizontal ) );
+
+        estimateRows( 0, count );
+    }
+
+    int rowAt( qreal pos ) const
+    {
+        return qBound( 0, extents.rowAt( pos ), count - 1 );
+    }
+
+    void releaseDelegate( QQuickItem* delegate )
+    {
+        delegate->setVisible( false );
+        pool += delegate;
+    }
+
+    void releaseDelegates()
+    {
+        for ( auto delegate : std::as_const( delegates ) )
+            releaseDelegate( delegate );
+
+        delegates.clear();
+        engine.clear();
+    }
+
+    void releaseDelegates( int from, int to )
+    {
+        // releasing the delegates of the rows outside of [from, to]
+
+        for ( auto it = delegates.begin(); it != delegates.end(); )
+        {
+            if ( it.key() < from || it.key() > to )
+            {
+                const auto delegate = it.value();
+
+                engine.removeAt( engine.indexOf( delegate ) );
+                releaseDelegate( delegate );
+
+                it = delegates.erase( it );
+            }
+            else
+            {
+                ++it;
+            }
+        }
+    }
+
+    QQuickItem* acquireDelegate()
+    {
+        if ( !pool.isEmpty() )
+            return pool.takeLast();
+
+        if ( delegateFactory )
+        {
+            if ( auto delegate = delegateFactory( contentsItem ) )
+            {
+                if ( delegate->parentItem() != contentsItem )
+                    delegate->setParentItem( contentsItem );
+
+                if ( delegate->parent() == nullptr )
+                    delegate->setParent( contentsItem );
+
+                return delegate;
+            }
+        }
+
+        return nullptr;
+    }
+
+    void updateDefaultExtent( Qt::Orientation orientation )
+    {
+        /*
+            Without an estimator we assume, that all rows have
+            the preferred extent of the first one.
+         */
+        defaultExtent = 0.0;
+
+        if ( sizeEstimator || count <= 0 )
+            return;
+
+        auto delegate = delegates.value( 0, nullptr );
+        if ( delegate == nullptr )
+        {
+            delegate = acquireDelegate();
+            if ( delegate == nullptr )
+                return;
+
+            if ( delegateBinder )
+                delegateBinder( delegate, 0 );
+
+            releaseDelegate( delegate );
+        }
+
+        const auto hint = qskSizeConstraint( delegate, Qt::PreferredSize );
+        defaultExtent = qMax( ( orientation == Qt::Vertical )
+            ? hint.height() : hint.width(), 0.0 );
+    }
+
+    QskLinearLayoutEngine engine;
+
+    ContentsItem* contentsItem = nullptr;
+
+    DelegateFactory delegateFactory;
+    DelegateBinder delegateBinder;
+    SizeEstimator sizeEstimator;
+
+    QMap< int, QQuickItem* > delegates; // instantiated rows
+    QVector< QQuickItem* > pool; // recyclable delegates
+
+    /*
+        The extents of the rows: measured from the delegates,
+        or estimated otherwise.
+     */
+    QskRowExtents extents;
+
+    int count = 0;
+    qreal cacheMargin = 0.0;
+    qreal defaultExtent = 0.0;
+
+    bool isDirty = true;
+};
+
+QskVirtualLinearBox::QskVirtualLinearBox( QQuickItem* parent )
+    : QskVirtualLinearBox( Qt::Vertical, parent )
+{
+}
+
+QskVirtualLinearBox::QskVirtualLinearBox(
+        Qt::Orientation orientation, QQuickItem* parent )
+    : Inherited( parent )
+    , m_data( new PrivateData( orientation ) )
+{
+    m_data->engine.setSpacing( 0.0, Qt::Horizontal | Qt::Vertical );
+
+    m_data->contentsItem = new ContentsItem( this, &m_data->engine );
+    m_data->contentsItem->setExtent( orientation, 0.0 );
+
+    setScrolledItem( m_data->contentsItem );
+
+    if ( orientation == Qt::Vertical )
+        setHorizontalScrollBarPolicy( Qt::ScrollBarAlwaysOff );
+    else
+        setVerticalScrollBarPolicy( Qt::ScrollBarAlwaysOff );
+
+    connect( this, &QskScrollBox::scrollPosChanged,
+        this, &QskVirtualLinearBox::updateRows );
+}
+
+QskVirtualLinearBox::~QskVirtualLinearBox()
+{
+    // the contents item refers to the layout engine
+    delete m_data->contentsItem;
+}
+
+void QskVirtualLinearBox::setOrientation( Qt::Orientation orientation )
+{
+    if ( m_data->engine.setOrientation( orientation ) )
+    {
+        if ( orientation == Qt::Vertical )
+        {
+            setHorizontalScrollBarPolicy( Qt::ScrollBarAlwaysOff );
+            setVerticalScrollBarPolicy( Qt::ScrollBarAsNeeded );
+        }
+        else
+        {
+            setVerticalScrollBarPolicy( Qt::ScrollBarAlwaysOff );
+            setHorizontalScrollBarPolicy( Qt::ScrollBarAsNeeded );
+        }
+
+        m_data->releaseDelegates();
+        invalidateRows();
+
+        Q_EMIT orientationChanged();
+    }
+}
+
+Qt::Orientation QskVirtualLinearBox::orientation() const
+{
+    return m_data->engine.orientation();
+}
+
+void QskVirtualLinearBox::setCount( int count )
+{
+    count = qMax( count, 0 );
+
+    if ( count != m_data->count )
+    {
+        const auto oldCount = m_data->count;
+        m_data->count = count;
+
+        if ( oldCount == 0 && !m_data->sizeEstimator )
+        {
+            // the default extent is taken from the first row
+            m_data->isDirty = true;
+        }
+
+        if ( !m_data->isDirty )
+        {
+            // only the rows, that have been added/removed, are affected
+
+            if ( count < oldCount )
+            {
+                m_data->releaseDelegates( 0, count - 1 );
+                m_data->extents.truncate( count );
+            }
+            else
+            {
+                m_data->estimateRows( oldCount, count );
+            }
+        }
+
+        polish();
+
+        Q_EMIT countChanged( count );
+    }
+}
+
+int QskVirtualLinearBox::count() const
+{
+    return m_data->count;
+}
+
+void QskVirtualLinearBox::setDelegateFactory( const DelegateFactory& factory )
+{
+    m_data->releaseDelegates();
+
+    qDeleteAll( m_data->pool );
+    m_data->pool.clear();
+
+    m_data->delegateFactory = factory;
+    invalidateRows();
+}
+
+void QskVirtualLinearBox::setDelegateBinder( const DelegateBinder& binder )
+{
+    m_data->delegateBinder = binder;
+    invalidateRows();
+}
+
+void QskVirtualLinearBox::setSizeEstimator( const SizeEstimator& estimator )
+{
+    m_data->sizeEstimator = estimator;
+    invalidateRows();
+}
+
+void QskVirtualLinearBox::setSpacing( qreal spacing )
+{
+    if ( m_data->engine.setSpacing( spacing, Qt::Horizontal | Qt::Vertical ) )
+    {
+        m_data->extents.setSpacing( m_data->engine.spacing( Qt::Horizontal ) );
+        polish();
+
+        Q_EMIT spacingChanged( m_data->engine.spacing( Qt::Horizontal ) );
+    }
+}
+
+void QskVirtualLinearBox::resetSpacing()
+{
+    setSpacing( m_data->engine.defaultSpacing( Qt::Horizontal ) );
+}
+
+qreal QskVirtualLinearBox::spacing() const
+{
+    return m_data->engine.spacing( Qt::Horizontal );
+}
+
+void QskVirtualLinearBox::setCacheMargin( qreal margin )
+{
+    margin = qMax( margin, 0.0 );
+
+    if ( margin != m_data->cacheMargin )
+    {
+        m_data->cacheMargin = margin;
+        updateRows();
+
+        Q_EMIT cacheMarginChanged( margin );
+    }
+}
+
+qreal QskVirtualLinearBox::cacheMargin() const
+{
+    return m_data->cacheMargin;
+}
+
+QQuickItem* QskVirtualLinearBox::delegateAt( int row ) const
+{
+    return m_data->delegates.value( row, nullptr );
+}
+
+int QskVirtualLinearBox::rowOf( const QQuickItem* delegate ) const
+{
+    for ( auto it = m_data->delegates.constBegin();
+        it != m_data->delegates.constEnd(); ++it )
+    {
+        if ( it.value() == delegate )
+            return it.key();
+    }
+
+    return -1;
+}
+
+int QskVirtualLinearBox::delegateCount() const
+{
+    return m_data->delegates.count() + m_data->pool.count();
+}
+
+QRectF QskVirtualLinearBox::rowRect( int row ) const
+{
+    if ( row < 0 || row >= m_data->count || m_data->isDirty )
+        return QRectF();
+
+    const auto start = m_data->rowStart( row );
+    const auto end = m_data->rowEnd( row );
+
+    const auto& contentsItem = m_data->contentsItem;
+
+    if ( orientation() == Qt::Vertical )
+        return QRectF( 0.0, start, contentsItem->width(), end - start );
+    else
+        return QRectF( start, 0.0, end - start, contentsItem->height() );
+}
+
+void QskVirtualLinearBox::invalidateRows()
+{
+    /*
+        The delegates are bound again and the extents of all
+        rows are estimated again
+     */
+    if ( m_data->delegateBinder )
+    {
+        for ( auto it = m_data->delegates.constBegin();
+            it != m_data->delegates.constEnd(); ++it )
+        {
+            m_data->delegateBinder( it.value(), it.key() );
+        }
+    }
+
+    m_data->engine.invalidate();
+    m_data->isDirty = true;
+
+    polish();
+}
+
+void QskVirtualLinearBox::invalidateRow( int row )
+{
+    if ( row < 0 || row >= m_data->count )
+        return;
+
+    if ( auto delegate = delegateAt( row ) )
+    {
+        if ( m_data->delegateBinder )
+            m_data->delegateBinder( delegate, row );
+
+        m_data->engine.invalidate( delegate );
+    }
+
+    if ( !m_data->isDirty )
+    {
+        // the extent of the row might have changed: O(log n)
+        m_data->estimateRow( row );
+    }
+
+    polish();
+}
+
+void QskVirtualLinearBox::updateLayout()
+{
+    if ( m_data->isDirty )
+    {
+        m_data->updateExtents( orientation() );
+        m_data->isDirty = false;
+    }
+
+    m_data->contentsItem->setExtent( orientation(), m_data->totalExtent() );
+
+    // resizing the contents item and adjusting the scroll position
+    Inherited::updateLayout();
+
+    updateRows();
+}
+
+void QskVirtualLinearBox::updateRows()
+{
+    if ( m_data->isDirty )
+    {
+        // we are waiting for updateLayout
+        return;
+    }
+
+    if ( m_data->count <= 0 )
+    {
+        m_data->releaseDelegates();
+        return;
+    }
+
+    const auto contentsItem = m_data->contentsItem;
+    const auto viewRect = viewContentsRect();
+
+    qreal from, to;
+
+    if ( orientation() == Qt::Vertical )
+    {
+        from = scrollPos().y();
+        to = from + viewRect.height();
+    }
+    else
+    {
+        from = scrollPos().x();
+        to = from + viewRect.width();
+    }
+
+    from -= m_data->cacheMargin;
+    to += m_data->cacheMargin;
+
+    const int firstRow = m_data->rowAt( from );
+    const int lastRow = m_data->rowAt( to );
+
+    auto& delegates = m_data->delegates;
+    auto& engine = m_data->engine;
+
+    // the delegates, that stay in range, keep their cached hints in the engine
+    m_data->releaseDelegates( firstRow, lastRow );
+
+    for ( int row = firstRow; row <= lastRow; row++ )
+    {
+        if ( delegates.contains( row ) )
+            continue;
+
+        auto delegate = m_data->acquireDelegate();
+        if ( delegate == nullptr )
+            break;
+
+        if ( m_data->delegateBinder )
+            m_data->delegateBinder( delegate, row );
+
+        delegate->setVisible( true );
+        delegates.insert( row, delegate );
+
+        // the delegates of all rows before are in the engine
+        engine.insertItem( delegate, row - firstRow );
+    }
+
+    if ( delegates.isEmpty() )
+        return;
+
+    /*
+        The preferred extents of the instantiated delegates replace
+        the estimated ones, so that the positions of the rows
+        converge to the real ones, while scrolling through the list.
+     */
+
+    const bool isVertical = ( orientation() == Qt::Vertical );
+
+    const auto constraint = isVertical
+        ? QSizeF( contentsItem->width(), -1.0 )
+        : QSizeF( -1.0, contentsItem->height() );
+
+    for ( auto it = delegates.constBegin(); it != delegates.constEnd(); ++it )
+    {
+        const auto hint = qskSizeConstraint( it.value(), Qt::PreferredSize, constraint );
+        m_data->extents.setExtent( it.key(), isVertical ? hint.height() : hint.width() );
+    }
+
+    contentsItem->setExtent( orientation(), m_data->totalExtent() );
+
+    const auto start = m_data->rowStart( delegates.firstKey() );
+    const auto end = m_data->rowEnd( delegates.lastKey() );
+
+    QRectF rect;
+    if ( isVertical )
+        rect.setRect( 0.0, start, contentsItem->width(), end - start );
+    else
+        rect.setRect( start, 0.0, end - start, contentsItem->height() );
+
+    engine.setGeometries( rect );
+}
+
+#include "moc_QskVirtualLinearBox.cpp"
@@ -0,0 +1,102 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) 2016 Uwe Rathmann
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#ifndef QSK_VIRTUAL_LINEAR_BOX_H
+#define QSK_VIRTUAL_LINEAR_BOX_H
+
+#include "QskScrollArea.h"
+#include <functional>
+
+/*
+    A scroll area for a long list of rows, where only the delegates
+    for the rows being visible in the viewport - plus a margin - exist.
+
+    The positions of the rows are calculated from an estimated extent,
+    that is replaced by the preferred extent of a delegate, once the row
+    has been instantiated. Positions and lookups are O(log n), and without
+    a size estimator the memory depends on the measured rows only.
+
+    The delegates of the visible rows are arranged by a
+    QskLinearLayoutEngine. Delegates, that are scrolled out of the
+    visible range, are recycled for other rows.
+ */
+class QSK_EXPORT QskVirtualLinearBox : public QskScrollArea
+{
+    Q_OBJECT
+
+    Q_PROPERTY( Qt::Orientation orientation READ orientation
+        WRITE setOrientation NOTIFY orientationChanged FINAL )
+
+    Q_PROPERTY( int count READ count WRITE setCount NOTIFY countChanged FINAL )
+
+    Q_PROPERTY( qreal spacing READ spacing WRITE setSpacing
+        RESET resetSpacing NOTIFY spacingChanged FINAL )
+
+    Q_PROPERTY( qreal cacheMargin READ cacheMargin
+        WRITE setCacheMargin NOTIFY cacheMarginChanged FINAL )
+
+    using Inherited = QskScrollArea;
+
+  public:
+    // creates a new delegate, that can be used for any row
+    using DelegateFactory = std::function< QQuickItem*( QQuickItem* parentItem ) >;
+
+    // assigns the data of a row to a - maybe recycled - delegate
+    using DelegateBinder = std::function< void( QQuickItem*, int row ) >;
+
+    // the extent of a row in direction of the orientation
+    using SizeEstimator = std::function< qreal( int row ) >;
+
+    QskVirtualLinearBox( QQuickItem* parent = nullptr );
+    QskVirtualLinearBox( Qt::Orientation, QQuickItem* parent = nullptr );
+
+    ~QskVirtualLinearBox() override;
+
+    void setOrientation( Qt::Orientation );
+    Qt::Orientation orientation() const;
+
+    void setCount( int );
+    int count() const;
+
+    void setDelegateFactory( const DelegateFactory& );
+    void setDelegateBinder( const DelegateBinder& );
+    void setSizeEstimator( const SizeEstimator& );
+
+    void setSpacing( qreal );
+    void resetSpacing();
+    qreal spacing() const;
+
+    // extra space before/after the viewport, where rows are instantiated
+    void setCacheMargin( qreal );
+    qreal cacheMargin() const;
+
+    QQuickItem* delegateAt( int row ) const; // nullptr, when not instantiated
+    int rowOf( const QQuickItem* delegate ) const;
+
+    int delegateCount() const;
+
+    QRectF rowRect( int row ) const;
+
+  public Q_SLOTS:
+    void invalidateRows();
+    void invalidateRow( int row );
+
+  Q_SIGNALS:
+    void orientationChanged();
+    void countChanged( int );
+    void spacingChanged( qreal );
+    void cacheMarginChanged( qreal );
+
+  protected:
+    void updateLayout() override;
+
+  private:
+    void updateRows();
+
+    class PrivateData;
+    std::unique_ptr< PrivateData > m_data;
+};
+
+#endif
@@ -13,6 +13,10 @@
 
 #include <qmath.h>
 #include <qpointer.h>
+#include <qhash.h>
+#include <qvarlengtharray.h>
+
+#include <algorithm>
 
 QSK_QT_PRIVATE_BEGIN
 #include <private/qquickitem_p.h>
@@ -144,9 +148,12 @@ class QskWindowPrivate : public QQuickWindowPrivate
         , deleteOnClose( false )
         , autoLayoutChildren( true )
         , showedOnce( false )
+        , depthOrderedPolish( true )
     {
     }
 
+    void orderItemsToPolish();
+
 #ifdef QSK_DEBUG_RENDER_TIMING
     QElapsedTimer renderInterval;
 #endif
@@ -161,12 +168,89 @@ class QskWindowPrivate : public QQuickWindowPrivate
 
     QskWindow::EventAcceptance eventAcceptance;
 
+    // polishes, that would have been done before the parent has been polished
+    quint64 avoidedPolishCount = 0;
+
     bool explicitLocale : 1;
     bool deleteOnClose : 1;
     bool autoLayoutChildren : 1;
     bool showedOnce : 1;
+    bool depthOrderedPolish : 1;
 };
 
+void QskWindowPrivate::orderItemsToPolish()
+{
+    /*
+        Qt processes the items to be polished from the end of the list, what
+        is an arbitrary order. So children might be polished before their
+        parents, that will resize them, and the children have to be polished
+        again. Sorting the list by the depth in the item tree - parents last -
+        ensures, that parents are done before their children.
+
+        Unfortunately the render loops call QQuickWindowPrivate::polishItems()
+        directly and we have to do the ordering in advance for the situations,
+        where QskWindow is involved. Requests, that are made during polishing,
+        are processed in the order of Qt, what happens to be the best order
+        for items, that are resized by their parents: they are done next.
+     */
+
+    if ( !depthOrderedPolish || itemsToPolish.count() < 2 )
+        return;
+
+    struct Entry
+    {
+        QQuickItem* item;
+        int depth;
+    };
+
+    const int count = itemsToPolish.count();
+
+    QHash< const QQuickItem*, int > positions;
+    positions.reserve( count );
+
+    for ( int i = 0; i < count; i++ )
+        positions.insert( itemsToPolish[i], i );
+
+    QVarLengthArray< Entry > entries;
+    entries.reserve( count );
+
+    for ( int i = 0; i < count; i++ )
+    {
+        const auto item = itemsToPolish[i];
+
+        bool isRedundant = false;
+        int depth = 0;
+
+        for ( auto it = item->parentItem(); it != nullptr; it = it->parentItem() )
+        {
+            if ( !isRedundant )
+            {
+                /*
+                    In the order of Qt an ancestor with a lower position
+                    would have been polished after the item
+                 */
+                const auto pos = positions.value( it, count );
+                isRedundant = pos < i;
+            }
+
+            depth++;
+        }
+
+        if ( isRedundant )
+            avoidedPolishCount++;
+
+        entries.append( { item, depth } );
+    }
+
+    auto cmp = []( const Entry& e1, const Entry& e2 )
+        { return e1.depth > e2.depth; };
+
+    std::stable_sort( entries.begin(), entries.end(), cmp );
+
+    for ( int i = 0; i < count; i++ )
+        itemsToPolish[i] = entries[i].item;
+}
+
 QskWindow::QskWindow( QWindow* parent )
     : Inherited( *( new QskWindowPrivate() ), parent )
 {
@@ -284,9 +368,34 @@ void QskWindow::addItem( QQuickItem* item )
 void QskWindow::polishItems()
 {
     Q_D( QskWindow );
+
+    d->orderItemsToPolish();
     d->polishItems();
 }
 
+void QskWindow::setDepthOrderedPolish( bool on )
+{
+    Q_D( QskWindow );
+
+    if ( on != d->depthOrderedPolish )
+    {
+        d->depthOrderedPolish = on;
+        Q_EMIT depthOrderedPolishChanged();
+    }
+}
+
+bool QskWindow::isDepthOrderedPolish() const
+{
+    Q_D( const QskWindow );
+    return d->depthOrderedPolish;
+}
+
+quint64 QskWindow::avoidedPolishCount() const
+{
+    Q_D( const QskWindow );
+    return d->avoidedPolishCount;
+}
+
 bool QskWindow::event( QEvent* event )
 {
     /*
@@ -369,6 +478,8 @@ bool QskWindow::event( QEvent* event )
                     << d->renderInterval.restart() << objectName();
             }
 #endif
+            // the render loop is about to polish the items
+            d->orderItemsToPolish();
             break;
         }
 
@@ -419,6 +530,8 @@ void QskWindow::exposeEvent( QExposeEvent* event )
     ensureFocus( Qt::OtherFocusReason );
     layoutItems();
 
+    d_func()->orderItemsToPolish();
+
     Inherited::exposeEvent( event );
 }
 
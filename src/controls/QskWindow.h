@@ -23,6 +23,9 @@ class QSK_EXPORT QskWindow : public QQuickWindow
     Q_PROPERTY( bool autoLayoutChildren READ autoLayoutChildren
         WRITE setAutoLayoutChildren NOTIFY autoLayoutChildrenChanged FINAL )
 
+    Q_PROPERTY( bool depthOrderedPolish READ isDepthOrderedPolish
+        WRITE setDepthOrderedPolish NOTIFY depthOrderedPolishChanged FINAL )
+
     Q_PROPERTY( QLocale locale READ locale
         WRITE setLocale RESET resetLocale NOTIFY localeChanged FINAL )
 
@@ -63,6 +66,11 @@ class QSK_EXPORT QskWindow : public QQuickWindow
 
     void polishItems();
 
+    void setDepthOrderedPolish( bool );
+    bool isDepthOrderedPolish() const;
+
+    quint64 avoidedPolishCount() const;
+
     void setCustomRenderMode( const char* mode );
     const char* customRenderMode() const;
 
@@ -78,6 +86,7 @@ class QSK_EXPORT QskWindow : public QQuickWindow
   Q_SIGNALS:
     void localeChanged( const QLocale& );
     void autoLayoutChildrenChanged();
+    void depthOrderedPolishChanged();
     void deleteOnCloseChanged();
 
   public Q_SLOTS:
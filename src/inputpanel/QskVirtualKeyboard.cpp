@@ -4,68 +4,280 @@
  *****************************************************************************/
 
 #include "QskVirtualKeyboard.h"
-#include "QskPushButton.h"
+#include "QskEvent.h"
 
+#include <qbasictimer.h>
 #include <qguiapplication.h>
 #include <qset.h>
 #include <qstylehints.h>
 
 namespace
 {
-    class Button : public QskPushButton
+    class Key
     {
       public:
-        Button( QskVirtualKeyboard* parent )
-            : QskPushButton( parent )
+        int code;
+        QRectF rect;
+    };
+
+    static bool qskIsAutorepeat( int key )
+    {
+        return (
+            ( key != Qt::Key_Return ) &&
+            ( key != Qt::Key_Enter ) &&
+            ( key != Qt::Key_Shift ) &&
+            ( key != Qt::Key_CapsLock ) &&
+            ( key != Qt::Key_Mode_switch ) );
+    }
+
+    static inline int qskAutoRepeatInterval()
+    {
+        const auto hints = QGuiApplication::styleHints();
+
+        auto interval = 1000.0;
+#if QT_VERSION >= QT_VERSION_CHECK( 6, 5, 0 )
+        interval /= hints->keyboardAutoRepeatRateF();
+#else
+        interval /= hints->keyboardAutoRepeatRate();
+#endif
+        return qRound( interval );
+    }
+
+    enum
+    {
+        RowEnd = -1,
+        ModeEnd = -2
+    };
+
+#define LOWER( x ) int( x + 32 ) // Convert an uppercase key to lowercase
+#include "QskVirtualKeyboardLayouts.cpp"
+#undef LOWER
+
+    using Layout = QskVirtualKeyboardLayouts::Layout;
+    using LayoutMember = Layout QskVirtualKeyboardLayouts::*;
+
+    class BuiltinLayout
+    {
+      public:
+        LayoutMember member;
+        const int* keys;
+    };
+
+#define QSK_BUILTIN_LAYOUT( name ) { &QskVirtualKeyboardLayouts::name, qskKeys_ ## name }
+
+    static const BuiltinLayout qskBuiltinLayouts[] =
+    {
+        QSK_BUILTIN_LAYOUT( bg ),
+        QSK_BUILTIN_LAYOUT( cs ),
+        QSK_BUILTIN_LAYOUT( de ),
+        QSK_BUILTIN_LAYOUT( da ),
+        QSK_BUILTIN_LAYOUT( el ),
+        QSK_BUILTIN_LAYOUT( en_GB ),
+        QSK_BUILTIN_LAYOUT( en_US ),
+        QSK_BUILTIN_LAYOUT( es ),
+        QSK_BUILTIN_LAYOUT( fi ),
+        QSK_BUILTIN_LAYOUT( fr ),
+        QSK_BUILTIN_LAYOUT( hu ),
+        QSK_BUILTIN_LAYOUT( it ),
+        QSK_BUILTIN_LAYOUT( ja ),
+        QSK_BUILTIN_LAYOUT( lv ),
+        QSK_BUILTIN_LAYOUT( lt ),
+        QSK_BUILTIN_LAYOUT( nl ),
+        QSK_BUILTIN_LAYOUT( pt ),
+        QSK_BUILTIN_LAYOUT( ro ),
+        QSK_BUILTIN_LAYOUT( ru ),
+        QSK_BUILTIN_LAYOUT( sl ),
+        QSK_BUILTIN_LAYOUT( sk ),
+        QSK_BUILTIN_LAYOUT( tr ),
+        QSK_BUILTIN_LAYOUT( zh )
+    };
+
+#undef QSK_BUILTIN_LAYOUT
+
+    static const int* qskBuiltinKeys( LayoutMember member )
+    {
+        for ( const auto& layout : qskBuiltinLayouts )
+        {
+            if ( layout.member == member )
+                return layout.keys;
+        }
+
+        return nullptr;
+    }
+
+    /*
+        The keys of a layout in a flat vector, where the rows of all modes
+        are indexed by their offsets. Only the layout of the current locale
+        is stored this way.
+     */
+    class KeyTable
+    {
+      public:
+        void setKeys( const int* keys )
         {
-            setFocusPolicy( Qt::TabFocus );
+            clear();
+
+            for ( int mode = 0; mode < QskVirtualKeyboard::ModeCount; mode++ )
+            {
+                m_modeOffsets[ mode ] = m_rowOffsets.size() - 1;
 
-            setSubcontrolProxy( QskPushButton::Panel, QskVirtualKeyboard::ButtonPanel );
-            setSubcontrolProxy( QskPushButton::Text, QskVirtualKeyboard::ButtonText );
+                for ( ; *keys != ModeEnd; keys++ )
+                {
+                    if ( *keys == RowEnd )
+                        m_rowOffsets += m_codes.size();
+                    else
+                        m_codes += *keys;
+                }
+
+                keys++;
+            }
+
+            m_modeOffsets[ QskVirtualKeyboard::ModeCount ] = m_rowOffsets.size() - 1;
+        }
+
+        void setLayout( const Layout& layout )
+        {
+            clear();
+
+            for ( int mode = 0; mode < QskVirtualKeyboard::ModeCount; mode++ )
+            {
+                m_modeOffsets[ mode ] = m_rowOffsets.size() - 1;
+
+                if ( mode < layout.size() )
+                {
+                    for ( const auto& row : layout[ mode ] )
+                    {
+                        m_codes += row;
+                        m_rowOffsets += m_codes.size();
+                    }
+                }
+            }
+
+            m_modeOffsets[ QskVirtualKeyboard::ModeCount ] = m_rowOffsets.size() - 1;
+        }
+
+        inline const QVector< int >& codes() const { return m_codes; }
+
+        inline int rowCount( int mode ) const
+        {
+            return m_modeOffsets[ mode + 1 ] - m_modeOffsets[ mode ];
         }
 
-        int key() const
+        inline const int* keys( int mode, int row ) const
         {
-            return m_key;
+            return m_codes.constData() + m_rowOffsets[ m_modeOffsets[ mode ] + row ];
         }
 
-        void setKey( int key )
+        inline int keyCount( int mode, int row ) const
         {
-            m_key = key;
+            const int i = m_modeOffsets[ mode ] + row;
+            return m_rowOffsets[ i + 1 ] - m_rowOffsets[ i ];
         }
 
       private:
-        int m_key = 0;
+        void clear()
+        {
+            m_codes.clear();
+            m_rowOffsets = { 0 };
+        }
+
+        QVector< int > m_codes;
+        QVector< int > m_rowOffsets = { 0 };
+        int m_modeOffsets[ QskVirtualKeyboard::ModeCount + 1 ] = {};
     };
 
-    static bool qskIsAutorepeat( int key )
+    static Layout qskLayout( const int* keys )
     {
-        return (
-            ( key != Qt::Key_Return ) &&
-            ( key != Qt::Key_Enter ) &&
-            ( key != Qt::Key_Shift ) &&
-            ( key != Qt::Key_CapsLock ) &&
-            ( key != Qt::Key_Mode_switch ) );
+        KeyTable table;
+        table.setKeys( keys );
+
+        Layout layout( QskVirtualKeyboard::ModeCount );
+
+        for ( int mode = 0; mode < QskVirtualKeyboard::ModeCount; mode++ )
+        {
+            auto& page = layout[ mode ];
+            page.reserve( table.rowCount( mode ) );
+
+            for ( int row = 0; row < table.rowCount( mode ); row++ )
+            {
+                const auto rowKeys = table.keys( mode, row );
+                page += QVector< int >( rowKeys, rowKeys + table.keyCount( mode, row ) );
+            }
+        }
+
+        return layout;
     }
 }
 
-
 QSK_SUBCONTROL( QskVirtualKeyboard, Panel )
 QSK_SUBCONTROL( QskVirtualKeyboard, ButtonPanel )
 QSK_SUBCONTROL( QskVirtualKeyboard, ButtonText )
 
+/*
+    The keys used to be push buttons: sharing the bit of QskAbstractButton::Pressed
+    keeps skins working, that style the keys with QskPushButton::Pressed.
+ */
+QSK_SYSTEM_STATE( QskVirtualKeyboard, Pressed, QskAspect::LastSystemState >> 2 )
+
 class QskVirtualKeyboard::PrivateData
 {
+  public:
+    void setKeyState( QskVirtualKeyboard* keyboard, int index, QskAspect::State state )
+    {
+        using Q = QskVirtualKeyboard;
+
+        auto& storedIndex = ( state == Q::Hovered )
+            ? hoveredIndex : ( ( state == Q::Pressed ) ? pressedIndex : focusedIndex );
+
+        if ( index == storedIndex )
+            return;
+
+        if ( storedIndex >= 0 )
+        {
+            const auto states = keyboard->keyStates( storedIndex );
+            startTransitions( keyboard, storedIndex, states, states & ~state );
+        }
+
+        if ( index >= 0 )
+        {
+            const auto states = keyboard->keyStates( index );
+            startTransitions( keyboard, index, states, states | state );
+        }
+
+        storedIndex = index;
+        keyboard->update();
+    }
+
+  private:
+    inline void startTransitions( QskVirtualKeyboard* keyboard, int index,
+        QskAspect::States oldStates, QskAspect::States newStates )
+    {
+        using Q = QskVirtualKeyboard;
+
+        keyboard->startHintTransitions(
+            { Q::ButtonPanel, Q::ButtonText }, oldStates, newStates, index );
+    }
+
   public:
     int rowCount = 5;
     int columnCount = 12;
 
-    QskVirtualKeyboardLayouts layouts;
-    const QskVirtualKeyboardLayouts::Layout* currentLayout = nullptr;
+    // only set, when the built-in layouts have been replaced
+    std::unique_ptr< QskVirtualKeyboardLayouts > customLayouts;
+
+    LayoutMember currentLayout = nullptr;
+    KeyTable keyTable;
     QskVirtualKeyboard::Mode mode = QskVirtualKeyboard::LowercaseMode;
 
-    QVector< Button* > keyButtons;
+    // the visible keys of the current mode, calculated in updateLayout
+    QVector< Key > keys;
     QSet< int > keyCodes;
+
+    int pressedIndex = -1;
+    int hoveredIndex = -1;
+    int focusedIndex = -1;
+
+    QBasicTimer repeatTimer;
 };
 
 QskVirtualKeyboard::QskVirtualKeyboard( QQuickItem* parent )
@@ -75,14 +287,11 @@ QskVirtualKeyboard::QskVirtualKeyboard( QQuickItem* parent )
     setPolishOnResize( true );
     initSizePolicy( QskSizePolicy::Expanding, QskSizePolicy::Fixed );
 
-#define LOWER( x ) int( x + 32 ) // Convert an uppercase key to lowercase
-    m_data->layouts =
-    {
-#include "QskVirtualKeyboardLayouts.cpp"
-    };
-#undef LOWER
+    setAcceptedMouseButtons( Qt::LeftButton );
+    setAcceptHoverEvents( true );
 
-    ensureButtons();
+    // the keys are navigated by an internal focus ( see keyPressEvent )
+    setFocusPolicy( Qt::TabFocus );
 
     connect( this, &QskControl::localeChanged,
         this, &QskVirtualKeyboard::updateLocale );
@@ -239,11 +448,17 @@ QskVirtualKeyboard::KeyType QskVirtualKeyboard::typeForKey( int key ) const
     }
 }
 
-void QskVirtualKeyboard::updateLayout() // ### fill keyCodes here
+void QskVirtualKeyboard::updateLayout()
 {
+    auto& keys = m_data->keys;
+    keys.clear();
+
     const auto r = layoutRect();
-    if ( r.isEmpty() )
+    if ( r.isEmpty() || m_data->currentLayout == nullptr )
+    {
+        update();
         return;
+    }
 
     const auto spacing = spacingHint( Panel );
     const auto totalVSpacing = ( rowCount() - 1 ) * spacing;
@@ -252,157 +467,510 @@ void QskVirtualKeyboard::updateLayout() // ### fill keyCodes here
 
     qreal yPos = r.top();
 
-    const auto& page = ( *m_data->currentLayout )[ mode() ];
+    const auto& table = m_data->keyTable;
+    const int rowCount = qMin( table.rowCount( mode() ), this->rowCount() );
+
+    keys.reserve( rowCount * columnCount() );
 
-    for ( int i = 0; i < page.size(); i++ )
+    for ( int i = 0; i < rowCount; i++ )
     {
-        const QVector< int > row = page[ i ];
+        const auto row = table.keys( mode(), i );
+        const auto count = table.keyCount( mode(), i );
 #if 1
         // there should be a better way
         auto totalHSpacing = -spacing;
         if ( spacing )
         {
-            for ( int j = 0; j < row.size(); j++ )
+            for ( int j = 0; j < count; j++ )
             {
                 if ( row[ j ] != 0 )
                     totalHSpacing += spacing;
             }
         }
 #endif
-        const auto baseKeyWidth = ( r.width() - totalHSpacing ) / rowStretch( row );
+        const auto baseKeyWidth = ( r.width() - totalHSpacing ) / rowStretch( row, count );
         qreal xPos = r.left();
 
-        for ( int j = 0; j < columnCount(); j++ )
+        const int columnCount = qMin( count, this->columnCount() );
+
+        for ( int j = 0; j < columnCount; j++ )
         {
-            auto button = m_data->keyButtons[ i * columnCount() + j ];
+            const int key = row[ j ];
 
-            if( j < row.size() )
+            if ( isKeyVisible( key ) )
             {
-                const int key = row[ j ];
-                button->setVisible( isKeyVisible( key ) );
+                const qreal keyWidth = baseKeyWidth * keyStretch( key );
 
-                if ( button->isVisible() )
-                {
-                    const qreal keyWidth = baseKeyWidth * keyStretch( key );
+                keys += Key { key, QRectF( xPos, yPos, keyWidth, keyHeight ) };
+                xPos += keyWidth + spacing;
+            }
+        }
 
-                    const QRectF rect( xPos, yPos, keyWidth, keyHeight );
+        yPos += keyHeight + spacing;
+    }
 
-                    button->setGeometry( rect );
-                    button->setAutoRepeat( qskIsAutorepeat( key ) );
-                    button->setKey( key );
-                    button->setText( textForKey( key ) );
+    if ( m_data->pressedIndex >= keys.size() )
+        setPressedKeyIndex( -1 );
 
-                    const auto type = typeForKey( key );
-                    const auto emphasis = emphasisForType( type );
-                    button->setEmphasis( emphasis );
+    if ( m_data->hoveredIndex >= keys.size() )
+        setHoveredKeyIndex( -1 );
 
-                    xPos += keyWidth + spacing;
-                }
-            }
-            else
-            {
-                button->setVisible( false );
-            }
-        }
+    if ( m_data->focusedIndex >= keys.size() )
+        setFocusedKeyIndex( keys.size() - 1 );
 
-        yPos += keyHeight + spacing;
+    update();
+
+    if ( m_data->focusedIndex >= 0 )
+        Q_EMIT focusIndicatorRectChanged();
+}
+
+int QskVirtualKeyboard::keyCount() const
+{
+    return m_data->keys.size();
+}
+
+int QskVirtualKeyboard::keyCodeAt( int index ) const
+{
+    const auto& keys = m_data->keys;
+    return ( index >= 0 && index < keys.size() ) ? keys[ index ].code : 0;
+}
+
+QString QskVirtualKeyboard::keyTextAt( int index ) const
+{
+    const auto& keys = m_data->keys;
+
+    if ( index >= 0 && index < keys.size() )
+        return textForKey( keys[ index ].code );
+
+    return QString();
+}
+
+QRectF QskVirtualKeyboard::keyRectAt( int index ) const
+{
+    const auto& keys = m_data->keys;
+    return ( index >= 0 && index < keys.size() ) ? keys[ index ].rect : QRectF();
+}
+
+int QskVirtualKeyboard::keyIndexAt( const QPointF& pos ) const
+{
+    const auto& keys = m_data->keys;
+
+    for ( int i = 0; i < keys.size(); i++ )
+    {
+        if ( keys[ i ].rect.contains( pos ) )
+            return i;
     }
+
+    return -1;
 }
 
-bool QskVirtualKeyboard::hasKey( int keyCode ) const
+int QskVirtualKeyboard::pressedKeyIndex() const
 {
-    return m_data->keyCodes.contains( keyCode );
+    return m_data->pressedIndex;
 }
 
-int QskVirtualKeyboard::rowCount() const
+int QskVirtualKeyboard::hoveredKeyIndex() const
 {
-    return m_data->rowCount;
+    return m_data->hoveredIndex;
 }
 
-void QskVirtualKeyboard::setRowCount( int rowCount )
+int QskVirtualKeyboard::focusedKeyIndex() const
 {
-    m_data->rowCount = rowCount;
-    ensureButtons();
+    return m_data->focusedIndex;
 }
 
-int QskVirtualKeyboard::columnCount() const
+QskAspect::States QskVirtualKeyboard::keyStates( int index ) const
 {
-    return m_data->columnCount;
+    /*
+        Pressed/Hovered/Focused of the keyboard are about one
+        of its keys and must not be applied to the others.
+     */
+    auto states = skinStates() & ~( Pressed | Hovered | Focused );
+
+    if ( index >= 0 )
+    {
+        if ( index == m_data->pressedIndex )
+            states |= Pressed;
+
+        if ( index == m_data->hoveredIndex )
+            states |= Hovered;
+
+        if ( index == m_data->focusedIndex )
+            states |= Focused;
+    }
+
+    return states;
 }
 
-void QskVirtualKeyboard::setColumnCount( int columnCount )
+QRectF QskVirtualKeyboard::focusIndicatorRect() const
 {
-    m_data->columnCount = columnCount;
-    ensureButtons();
+    if ( m_data->focusedIndex >= 0 )
+        return keyRectAt( m_data->focusedIndex );
+
+    return Inherited::focusIndicatorRect();
 }
 
-QskVirtualKeyboardLayouts QskVirtualKeyboard::layouts() const
+QskAspect::Variation QskVirtualKeyboard::effectiveVariation() const
 {
-    return m_data->layouts;
+    /*
+        The emphasis of a key depends on its type. As all keys are
+        samples of the same subcontrols we have to find out, which key
+        is currently resolving its hints.
+     */
+    const auto index = effectiveSampleIndex();
+    if ( index < 0 || index >= m_data->keys.size() )
+        return Inherited::effectiveVariation();
+
+    switch( typeForKey( m_data->keys[ index ].code ) )
+    {
+        case EnterType:
+            return QskAspect::Huge;
+
+        case BackspaceType:
+        case CapsSwitchType:
+            return QskAspect::Large;
+
+        case ModeSwitchType:
+            return QskAspect::Small;
+
+        case SpecialCharacterType:
+            return QskAspect::Tiny;
+
+        default:
+            return QskAspect::NoVariation;
+    }
 }
 
-void QskVirtualKeyboard::setLayouts( const QskVirtualKeyboardLayouts& layouts )
+void QskVirtualKeyboard::mousePressEvent( QMouseEvent* event )
+{
+    const auto index = keyIndexAt( qskMousePosition( event ) );
+    if ( index < 0 )
+    {
+        Inherited::mousePressEvent( event );
+        return;
+    }
+
+    setPressedKeyIndex( index );
+
+    const auto key = m_data->keys[ index ].code;
+
+    if ( qskIsAutorepeat( key ) )
+        m_data->repeatTimer.start( 500, this );
+
+    keyPressed( key );
+}
+
+void QskVirtualKeyboard::mouseMoveEvent( QMouseEvent* event )
+{
+    if ( m_data->pressedIndex >= 0 )
+    {
+        const auto pos = qskMousePosition( event );
+
+        if ( !keyRectAt( m_data->pressedIndex ).contains( pos ) )
+            setPressedKeyIndex( -1 );
+    }
+}
+
+void QskVirtualKeyboard::mouseReleaseEvent( QMouseEvent* )
+{
+    setPressedKeyIndex( -1 );
+}
+
+void QskVirtualKeyboard::mouseUngrabEvent()
 {
-    m_data->layouts = layouts;
+    setPressedKeyIndex( -1 );
+    Inherited::mouseUngrabEvent();
 }
 
-void QskVirtualKeyboard::ensureButtons()
+void QskVirtualKeyboard::keyPressEvent( QKeyEvent* event )
 {
-    const int newButtonSize = rowCount() * columnCount();
-    const int oldButtonSize = m_data->keyButtons.size();
+    const auto& keys = m_data->keys;
 
-    if( newButtonSize == oldButtonSize )
+    if ( keys.isEmpty() )
+    {
+        Inherited::keyPressEvent( event );
         return;
+    }
 
-    const auto hints = QGuiApplication::styleHints();
+    const int focusedIndex = m_data->focusedIndex;
 
-    auto autoRepeatInterval = 1000.0;
-#if QT_VERSION >= QT_VERSION_CHECK( 6, 5, 0 )
-        autoRepeatInterval /= hints->keyboardAutoRepeatRateF();
-#else
-        autoRepeatInterval /= hints->keyboardAutoRepeatRate();
-#endif
+    switch ( event->key() )
+    {
+        case Qt::Key_Left:
+        case Qt::Key_Right:
+        {
+            const int step = ( event->key() == Qt::Key_Right ) ? 1 : -1;
+            const int lastIndex = keys.size() - 1;
+            setFocusedKeyIndex( qBound( 0, focusedIndex + step, lastIndex ) );
+
+            return;
+        }
+
+        case Qt::Key_Up:
+        case Qt::Key_Down:
+        {
+            const auto index = neighborKeyIndex(
+                focusedIndex, event->key() == Qt::Key_Down );
 
-    m_data->keyButtons.reserve( rowCount() * columnCount() );
+            if ( index >= 0 )
+                setFocusedKeyIndex( index );
+
+            return;
+        }
+    }
 
-    for( int i = 0; i < rowCount(); i++ )
+    if ( qskIsButtonPressKey( event ) )
     {
-        for( int j = 0; j < columnCount(); j++ )
+        if ( focusedIndex >= 0 && !event->isAutoRepeat() )
         {
-            const int index = i * columnCount() + j;
+            // repeating like when being pressed by the mouse
+            setPressedKeyIndex( focusedIndex );
 
-            if( index >= m_data->keyButtons.size() )
-            {
-                auto button = new Button( this );
-                button->installEventFilter( this );
+            const auto key = keys[ focusedIndex ].code;
 
-                button->setAutoRepeat( false );
-                button->setAutoRepeatDelay( 500 );
-                button->setAutoRepeatInterval( autoRepeatInterval );
+            if ( qskIsAutorepeat( key ) )
+                m_data->repeatTimer.start( 500, this );
 
-                connect( button, &QskPushButton::pressed,
-                    this, &QskVirtualKeyboard::buttonPressed );
+            keyPressed( key );
+        }
 
-                m_data->keyButtons += button;
-            }
+        return;
+    }
+
+    const auto index = focusedIndex + qskFocusChainIncrement( event );
+
+    if ( index != focusedIndex && index >= 0 && index < keys.size() )
+    {
+        setFocusedKeyIndex( index );
+        return;
+    }
+
+    Inherited::keyPressEvent( event );
+}
+
+void QskVirtualKeyboard::keyReleaseEvent( QKeyEvent* event )
+{
+    if ( qskIsButtonPressKey( event ) )
+    {
+        if ( !event->isAutoRepeat() )
+            setPressedKeyIndex( -1 );
+
+        return;
+    }
+
+    Inherited::keyReleaseEvent( event );
+}
+
+void QskVirtualKeyboard::focusInEvent( QFocusEvent* event )
+{
+    const int count = m_data->keys.size();
+
+    int index = m_data->focusedIndex;
+
+    switch( event->reason() )
+    {
+        case Qt::TabFocusReason:
+        {
+            index = 0;
+            break;
+        }
+
+        case Qt::BacktabFocusReason:
+        {
+            index = count - 1;
+            break;
+        }
+
+        default:
+        {
+            if ( index < 0 || index >= count )
+                index = 0;
         }
     }
 
-    while( m_data->keyButtons.size() > newButtonSize )
+    setFocusedKeyIndex( qMin( index, count - 1 ) );
+
+    Inherited::focusInEvent( event );
+}
+
+void QskVirtualKeyboard::focusOutEvent( QFocusEvent* event )
+{
+    setPressedKeyIndex( -1 );
+    setFocusedKeyIndex( -1 );
+
+    Inherited::focusOutEvent( event );
+}
+
+void QskVirtualKeyboard::hoverEnterEvent( QHoverEvent* event )
+{
+    Inherited::hoverEnterEvent( event );
+    setHoveredKeyIndex( keyIndexAt( qskHoverPosition( event ) ) );
+}
+
+void QskVirtualKeyboard::hoverMoveEvent( QHoverEvent* event )
+{
+    Inherited::hoverMoveEvent( event );
+    setHoveredKeyIndex( keyIndexAt( qskHoverPosition( event ) ) );
+}
+
+void QskVirtualKeyboard::hoverLeaveEvent( QHoverEvent* event )
+{
+    Inherited::hoverLeaveEvent( event );
+    setHoveredKeyIndex( -1 );
+}
+
+void QskVirtualKeyboard::timerEvent( QTimerEvent* event )
+{
+    if ( event->timerId() == m_data->repeatTimer.timerId() )
     {
-        auto* button = m_data->keyButtons.takeLast();
-        button->deleteLater();
+        const auto key = keyCodeAt( m_data->pressedIndex );
+
+        if ( qskIsAutorepeat( key ) )
+        {
+            m_data->repeatTimer.start( qskAutoRepeatInterval(), this );
+            keyPressed( key );
+        }
+        else
+        {
+            m_data->repeatTimer.stop();
+        }
+
+        return;
     }
+
+    Inherited::timerEvent( event );
 }
 
-void QskVirtualKeyboard::buttonPressed()
+void QskVirtualKeyboard::setPressedKeyIndex( int index )
 {
-    const auto button = static_cast< const Button* >( sender() );
-    if ( button == nullptr )
+    if ( index < 0 )
+        m_data->repeatTimer.stop();
+
+    m_data->setKeyState( this, index, Pressed );
+}
+
+void QskVirtualKeyboard::setHoveredKeyIndex( int index )
+{
+    m_data->setKeyState( this, index, Hovered );
+}
+
+void QskVirtualKeyboard::setFocusedKeyIndex( int index )
+{
+    if ( index == m_data->focusedIndex )
         return;
 
-    const int key = button->key();
+    m_data->setKeyState( this, index, Focused );
+    Q_EMIT focusIndicatorRectChanged();
+}
+
+int QskVirtualKeyboard::neighborKeyIndex( int index, bool below ) const
+{
+    const auto& keys = m_data->keys;
+
+    if ( index < 0 || index >= keys.size() )
+        return -1;
 
+    const auto rect = keys[ index ].rect;
+
+    // the keys of the next row in the requested direction
+
+    qreal rowY = 0.0;
+    bool hasRow = false;
+
+    for ( const auto& key : keys )
+    {
+        const auto y = key.rect.top();
+
+        if ( below ? ( y > rect.top() ) : ( y < rect.top() ) )
+        {
+            if ( !hasRow || ( below ? ( y < rowY ) : ( y > rowY ) ) )
+            {
+                rowY = y;
+                hasRow = true;
+            }
+        }
+    }
+
+    if ( !hasRow )
+        return -1;
+
+    // the key of this row, that is horizontally closest
+
+    int neighbor = -1;
+    qreal minDistance = 0.0;
+
+    for ( int i = 0; i < keys.size(); i++ )
+    {
+        const auto& keyRect = keys[ i ].rect;
+
+        if ( keyRect.top() == rowY )
+        {
+            const auto distance = qAbs( keyRect.center().x() - rect.center().x() );
+
+            if ( neighbor < 0 || distance < minDistance )
+            {
+                neighbor = i;
+                minDistance = distance;
+            }
+        }
+    }
+
+    return neighbor;
+}
+
+bool QskVirtualKeyboard::hasKey( int keyCode ) const
+{
+    return m_data->keyCodes.contains( keyCode );
+}
+
+int QskVirtualKeyboard::rowCount() const
+{
+    return m_data->rowCount;
+}
+
+void QskVirtualKeyboard::setRowCount( int rowCount )
+{
+    m_data->rowCount = rowCount;
+    polish();
+}
+
+int QskVirtualKeyboard::columnCount() const
+{
+    return m_data->columnCount;
+}
+
+void QskVirtualKeyboard::setColumnCount( int columnCount )
+{
+    m_data->columnCount = columnCount;
+    polish();
+}
+
+QskVirtualKeyboardLayouts QskVirtualKeyboard::layouts() const
+{
+    if ( m_data->customLayouts )
+        return *m_data->customLayouts;
+
+    QskVirtualKeyboardLayouts layouts;
+
+    for ( const auto& layout : qskBuiltinLayouts )
+        layouts.*layout.member = qskLayout( layout.keys );
+
+    return layouts;
+}
+
+void QskVirtualKeyboard::setLayouts( const QskVirtualKeyboardLayouts& layouts )
+{
+    m_data->customLayouts.reset( new QskVirtualKeyboardLayouts( layouts ) );
+
+    if ( m_data->currentLayout )
+    {
+        updateKeyTable();
+        polish();
+    }
+}
+
+void QskVirtualKeyboard::keyPressed( int key )
+{
     // Mode-switching keys
     switch ( key )
     {
@@ -435,35 +1003,36 @@ void QskVirtualKeyboard::buttonPressed()
     }
 }
 
-void QskVirtualKeyboard::updateKeyCodes()
+void QskVirtualKeyboard::updateKeyTable()
 {
-    m_data->keyCodes = {};
-    m_data->keyCodes.reserve( rowCount() * columnCount() );
+    /*
+        Only the layout of the current locale is materialized. The built-in
+        layouts are static tables, that don't need to be copied before.
+     */
+    auto& table = m_data->keyTable;
+
+    if ( m_data->customLayouts )
+        table.setLayout( ( *m_data->customLayouts ).*m_data->currentLayout );
+    else
+        table.setKeys( qskBuiltinKeys( m_data->currentLayout ) );
 
-    const auto layout = *m_data->currentLayout;
+    const auto& codes = table.codes();
 
-    for ( int mode = 0; mode < layout.size(); mode++ )
-    {
-        const auto& page = layout[ mode ];
-
-        for ( int i = 0; i < page.size(); i++ )
-        {
-            const auto& row = page[ i ];
+    m_data->keyCodes = {};
+    m_data->keyCodes.reserve( codes.size() );
 
-            for ( int j = 0; j < row.size(); j++ )
-            {
-                m_data->keyCodes += row[ j ];
-            }
-        }
-    }
+    for ( const auto code : codes )
+        m_data->keyCodes += code;
 }
 
-qreal QskVirtualKeyboard::rowStretch( const QVector< int >& row )
+qreal QskVirtualKeyboard::rowStretch( const int* keys, int count )
 {
     qreal stretch = 0;
 
-    for ( const int& key : row )
+    for ( int i = 0; i < count; i++ )
     {
+        const auto key = keys[ i ];
+
         if ( !key )
         {
             continue;
@@ -482,28 +1051,28 @@ qreal QskVirtualKeyboard::rowStretch( const QVector< int >& row )
 
 void QskVirtualKeyboard::updateLocale( const QLocale& locale )
 {
-    const QskVirtualKeyboardLayouts::Layout* newLayout = nullptr;
+    LayoutMember newLayout = nullptr;
 
     switch ( locale.language() )
     {
         case QLocale::Bulgarian:
-            newLayout = &m_data->layouts.bg;
+            newLayout = &QskVirtualKeyboardLayouts::bg;
             break;
 
         case QLocale::Czech:
-            newLayout = &m_data->layouts.cs;
+            newLayout = &QskVirtualKeyboardLayouts::cs;
             break;
 
         case QLocale::German:
-            newLayout = &m_data->layouts.de;
+            newLayout = &QskVirtualKeyboardLayouts::de;
             break;
 
         case QLocale::Danish:
-            newLayout = &m_data->layouts.da;
+            newLayout = &QskVirtualKeyboardLayouts::da;
             break;
 
         case QLocale::Greek:
-            newLayout = &m_data->layouts.el;
+            newLayout = &QskVirtualKeyboardLayouts::el;
             break;
 
         case QLocale::English:
@@ -521,11 +1090,11 @@ void QskVirtualKeyboard::updateLocale( const QLocale& locale )
                 case QLocale::UnitedStates:
                 case QLocale::UnitedStatesMinorOutlyingIslands:
                 case QLocale::UnitedStatesVirginIslands:
-                    newLayout = &m_data->layouts.en_US;
+                    newLayout = &QskVirtualKeyboardLayouts::en_US;
                     break;
 
                 default:
-                    newLayout = &m_data->layouts.en_GB;
+                    newLayout = &QskVirtualKeyboardLayouts::en_GB;
                     break;
             }
 
@@ -533,82 +1102,82 @@ void QskVirtualKeyboard::updateLocale( const QLocale& locale )
         }
 
         case QLocale::Spanish:
-            newLayout = &m_data->layouts.es;
+            newLayout = &QskVirtualKeyboardLayouts::es;
             break;
 
         case QLocale::Finnish:
-            newLayout = &m_data->layouts.fi;
+            newLayout = &QskVirtualKeyboardLayouts::fi;
             break;
 
         case QLocale::French:
-            newLayout = &m_data->layouts.fr;
+            newLayout = &QskVirtualKeyboardLayouts::fr;
             break;
 
         case QLocale::Hungarian:
-            newLayout = &m_data->layouts.hu;
+            newLayout = &QskVirtualKeyboardLayouts::hu;
             break;
 
         case QLocale::Italian:
-            newLayout = &m_data->layouts.it;
+            newLayout = &QskVirtualKeyboardLayouts::it;
             break;
 
         case QLocale::Japanese:
-            newLayout = &m_data->layouts.ja;
+            newLayout = &QskVirtualKeyboardLayouts::ja;
             break;
 
         case QLocale::Latvian:
-            newLayout = &m_data->layouts.lv;
+            newLayout = &QskVirtualKeyboardLayouts::lv;
             break;
 
         case QLocale::Lithuanian:
-            newLayout = &m_data->layouts.lt;
+            newLayout = &QskVirtualKeyboardLayouts::lt;
             break;
 
         case QLocale::Dutch:
-            newLayout = &m_data->layouts.nl;
+            newLayout = &QskVirtualKeyboardLayouts::nl;
             break;
 
         case QLocale::Portuguese:
-            newLayout = &m_data->layouts.pt;
+            newLayout = &QskVirtualKeyboardLayouts::pt;
             break;
 
         case QLocale::Romanian:
-            newLayout = &m_data->layouts.ro;
+            newLayout = &QskVirtualKeyboardLayouts::ro;
             break;
 
         case QLocale::Russian:
-            newLayout = &m_data->layouts.ru;
+            newLayout = &QskVirtualKeyboardLayouts::ru;
             break;
 
         case QLocale::Slovenian:
-            newLayout = &m_data->layouts.sl;
+            newLayout = &QskVirtualKeyboardLayouts::sl;
             break;
 
         case QLocale::Slovak:
-            newLayout = &m_data->layouts.sk;
+            newLayout = &QskVirtualKeyboardLayouts::sk;
             break;
 
         case QLocale::Turkish:
-            newLayout = &m_data->layouts.tr;
+            newLayout = &QskVirtualKeyboardLayouts::tr;
             break;
 
         case QLocale::Chinese:
-            newLayout = &m_data->layouts.zh;
+            newLayout = &QskVirtualKeyboardLayouts::zh;
             break;
 #if 1
         case QLocale::C:
-            newLayout = &m_data->layouts.en_US;
+            newLayout = &QskVirtualKeyboardLayouts::en_US;
             break;
 #endif
         default:
             qWarning() << "QskVirtualKeyboard: unsupported locale:" << locale;
-            newLayout = &m_data->layouts.en_US;
+            newLayout = &QskVirtualKeyboardLayouts::en_US;
     }
 
     if ( newLayout != m_data->currentLayout )
     {
         m_data->currentLayout = newLayout;
-        updateKeyCodes();
+        updateKeyTable();
 
         setMode( LowercaseMode );
         polish();
@@ -616,26 +1185,4 @@ void QskVirtualKeyboard::updateLocale( const QLocale& locale )
     }
 }
 
-QskPushButton::Emphasis QskVirtualKeyboard::emphasisForType( KeyType type )
-{
-    switch( type )
-    {
-        case EnterType:
-            return QskPushButton::VeryHighEmphasis;
-
-        case BackspaceType:
-        case CapsSwitchType:
-            return QskPushButton::HighEmphasis;
-
-        case ModeSwitchType:
-            return QskPushButton::LowEmphasis;
-
-        case SpecialCharacterType:
-            return QskPushButton::VeryLowEmphasis;
-
-        default:
-            return QskPushButton::NoEmphasis;
-    }
-}
-
 #include "moc_QskVirtualKeyboard.cpp"
@@ -7,7 +7,6 @@
 #define QSK_VIRTUAL_KEYBOARD_H
 
 #include "QskBox.h"
-#include "QskPushButton.h"
 
 class QSK_EXPORT QskVirtualKeyboardLayouts
 {
@@ -39,6 +38,12 @@ class QSK_EXPORT QskVirtualKeyboardLayouts
     Layout zh; // Chinese
 };
 
+/*
+    The keys are no items: they are rendered as samples of the
+    ButtonPanel/ButtonText subcontrols ( see QskVirtualKeyboardSkinlet )
+    and mouse/hover events are mapped to keys by their geometries.
+    Keyboard navigation moves an internal focus between the keys.
+ */
 class QSK_EXPORT QskVirtualKeyboard : public QskBox
 {
     Q_OBJECT
@@ -50,6 +55,7 @@ class QSK_EXPORT QskVirtualKeyboard : public QskBox
 
   public:
     QSK_SUBCONTROLS( Panel, ButtonPanel, ButtonText )
+    QSK_STATES( Pressed )
 
     enum Mode
     {
@@ -87,9 +93,34 @@ class QSK_EXPORT QskVirtualKeyboard : public QskBox
     int columnCount() const;
     void setColumnCount( int );
 
+    /*
+        The built-in layouts are static tables of key codes, and only
+        the layout for the current locale gets unpacked. Retrieving
+        all of them with layouts() is an expensive operation.
+     */
     QskVirtualKeyboardLayouts layouts() const;
     void setLayouts( const QskVirtualKeyboardLayouts& );
 
+    // the visible keys of the current mode
+    int keyCount() const;
+
+    int keyCodeAt( int index ) const;
+    QString keyTextAt( int index ) const;
+    QRectF keyRectAt( int index ) const;
+
+    int keyIndexAt( const QPointF& ) const;
+
+    int pressedKeyIndex() const;
+    int hoveredKeyIndex() const;
+    int focusedKeyIndex() const;
+
+    // the states of a key, resolved from the pressed/hovered/focused keys
+    QskAspect::States keyStates( int index ) const;
+
+    QRectF focusIndicatorRect() const override;
+
+    QskAspect::Variation effectiveVariation() const override;
+
   Q_SIGNALS:
     void modeChanged( QskVirtualKeyboard::Mode );
     void keyboardLayoutChanged();
@@ -101,16 +132,35 @@ class QSK_EXPORT QskVirtualKeyboard : public QskBox
     virtual QString textForKey( int ) const;
     virtual KeyType typeForKey( int ) const;
 
+    void keyPressEvent( QKeyEvent* ) override;
+    void keyReleaseEvent( QKeyEvent* ) override;
+
+    void focusInEvent( QFocusEvent* ) override;
+    void focusOutEvent( QFocusEvent* ) override;
+
+    void mousePressEvent( QMouseEvent* ) override;
+    void mouseMoveEvent( QMouseEvent* ) override;
+    void mouseReleaseEvent( QMouseEvent* ) override;
+    void mouseUngrabEvent() override;
+
+    void hoverEnterEvent( QHoverEvent* ) override;
+    void hoverMoveEvent( QHoverEvent* ) override;
+    void hoverLeaveEvent( QHoverEvent* ) override;
+
+    void timerEvent( QTimerEvent* ) override;
+
     void updateLayout() override;
     QSizeF layoutSizeHint( Qt::SizeHint, const QSizeF& ) const override;
 
   private:
-    void ensureButtons();
-    void buttonPressed();
-    void updateKeyCodes();
-    QskPushButton::Emphasis emphasisForType( KeyType );
-
-    qreal rowStretch( const QVector< int >& );
+    void keyPressed( int keyCode );
+    void setPressedKeyIndex( int );
+    void setHoveredKeyIndex( int );
+    void setFocusedKeyIndex( int );
+    int neighborKeyIndex( int index, bool below ) const;
+    void updateKeyTable();
+
+    qreal rowStretch( const int* keys, int count );
 
     class PrivateData;
     std::unique_ptr< PrivateData > m_data;
@@ -0,0 +1,105 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) 2016 Uwe Rathmann
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#include "QskVirtualKeyboardSkinlet.h"
+#include "QskVirtualKeyboard.h"
+
+QskVirtualKeyboardSkinlet::QskVirtualKeyboardSkinlet( QskSkin* skin )
+    : Inherited( skin )
+{
+    setNodeRoles( { PanelRole, ButtonPanelRole, ButtonTextRole } );
+}
+
+QskVirtualKeyboardSkinlet::~QskVirtualKeyboardSkinlet()
+{
+}
+
+QSGNode* QskVirtualKeyboardSkinlet::updateSubNode(
+    const QskSkinnable* skinnable, quint8 nodeRole, QSGNode* node ) const
+{
+    using Q = QskVirtualKeyboard;
+
+    switch ( nodeRole )
+    {
+        case ButtonPanelRole:
+            return updateSeriesNode( skinnable, Q::ButtonPanel, node );
+
+        case ButtonTextRole:
+            return updateSeriesNode( skinnable, Q::ButtonText, node );
+    }
+
+    return Inherited::updateSubNode( skinnable, nodeRole, node );
+}
+
+int QskVirtualKeyboardSkinlet::sampleCount(
+    const QskSkinnable* skinnable, QskAspect::Subcontrol ) const
+{
+    const auto keyboard = static_cast< const QskVirtualKeyboard* >( skinnable );
+    return keyboard->keyCount();
+}
+
+QRectF QskVirtualKeyboardSkinlet::sampleRect( const QskSkinnable* skinnable,
+    const QRectF&, QskAspect::Subcontrol subControl, int index ) const
+{
+    using Q = QskVirtualKeyboard;
+
+    /*
+        The geometries of the keys have been calculated, when polishing
+        the keyboard ( QskVirtualKeyboard::updateLayout ).
+     */
+    const auto keyboard = static_cast< const QskVirtualKeyboard* >( skinnable );
+
+    const auto r = keyboard->keyRectAt( index );
+
+    if ( subControl == Q::ButtonPanel )
+        return r;
+
+    if ( subControl == Q::ButtonText )
+    {
+        const auto panelRect = r.marginsRemoved( keyboard->marginHint( Q::ButtonPanel ) );
+        return keyboard->innerBox( Q::ButtonPanel, panelRect );
+    }
+
+    return QRectF();
+}
+
+int QskVirtualKeyboardSkinlet::sampleIndexAt( const QskSkinnable* skinnable,
+    const QRectF&, QskAspect::Subcontrol, const QPointF& pos ) const
+{
+    const auto keyboard = static_cast< const QskVirtualKeyboard* >( skinnable );
+    return keyboard->keyIndexAt( pos );
+}
+
+QskAspect::States QskVirtualKeyboardSkinlet::sampleStates(
+    const QskSkinnable* skinnable, QskAspect::Subcontrol, int index ) const
+{
+    const auto keyboard = static_cast< const QskVirtualKeyboard* >( skinnable );
+    return keyboard->keyStates( index );
+}
+
+QSGNode* QskVirtualKeyboardSkinlet::updateSampleNode( const QskSkinnable* skinnable,
+    QskAspect::Subcontrol subControl, int index, QSGNode* node ) const
+{
+    using Q = QskVirtualKeyboard;
+
+    const auto keyboard = static_cast< const QskVirtualKeyboard* >( skinnable );
+
+    const auto rect = sampleRect( keyboard, keyboard->contentsRect(), subControl, index );
+
+    if ( subControl == Q::ButtonPanel )
+        return updateBoxNode( keyboard, node, rect, subControl );
+
+    if ( subControl == Q::ButtonText )
+    {
+        const auto alignment = keyboard->alignmentHint( subControl, Qt::AlignCenter );
+
+        return updateTextNode( keyboard, node, rect,
+            alignment, keyboard->keyTextAt( index ), subControl );
+    }
+
+    return nullptr;
+}
+
+#include "moc_QskVirtualKeyboardSkinlet.cpp"
@@ -0,0 +1,49 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) 2016 Uwe Rathmann
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#ifndef QSK_VIRTUAL_KEYBOARD_SKINLET_H
+#define QSK_VIRTUAL_KEYBOARD_SKINLET_H
+
+#include "QskBoxSkinlet.h"
+
+class QSK_EXPORT QskVirtualKeyboardSkinlet : public QskBoxSkinlet
+{
+    Q_GADGET
+
+    using Inherited = QskBoxSkinlet;
+
+  public:
+    enum NodeRole
+    {
+        PanelRole,
+        ButtonPanelRole,
+        ButtonTextRole,
+
+        RoleCount
+    };
+
+    Q_INVOKABLE QskVirtualKeyboardSkinlet( QskSkin* = nullptr );
+    ~QskVirtualKeyboardSkinlet() override;
+
+    int sampleCount( const QskSkinnable*, QskAspect::Subcontrol ) const override;
+
+    QRectF sampleRect( const QskSkinnable*,
+        const QRectF&, QskAspect::Subcontrol, int index ) const override;
+
+    int sampleIndexAt( const QskSkinnable*, const QRectF&,
+        QskAspect::Subcontrol, const QPointF& ) const override;
+
+    QskAspect::States sampleStates( const QskSkinnable*,
+        QskAspect::Subcontrol, int index ) const override;
+
+  protected:
+    QSGNode* updateSubNode( const QskSkinnable*,
+        quint8 nodeRole, QSGNode* ) const override;
+
+    QSGNode* updateSampleNode( const QskSkinnable*,
+        QskAspect::Subcontrol, int index, QSGNode* ) const override;
+};
+
+#endif
@@ -14,15 +14,15 @@ static void qskSetItemActive( QObject* receiver, const QQuickItem* item, bool on
 {
     /*
         For QQuickItems not being derived from QskControl we manually
-        send QEvent::LayoutRequest events.
+        send layout requests.
      */
 
     if ( on )
     {
         auto sendLayoutRequest =
-            [receiver]()
+            [receiver, item]()
             {
-                QEvent event( QEvent::LayoutRequest );
+                QskLayoutRequestEvent event( item );
                 QCoreApplication::sendEvent( receiver, &event );
             };
 
@@ -461,6 +461,26 @@ bool QskGridBox::event( QEvent* event )
 {
     switch ( static_cast< int >( event->type() ) )
     {
+        case QskEvent::ItemLayoutRequest:
+        {
+            /*
+                When knowing the item, that has initiated the request,
+                the cached values of all other items remain valid.
+             */
+            auto requestEvent = static_cast< const QskLayoutRequestEvent* >( event );
+
+            if ( const auto item = requestEvent->item() )
+            {
+                m_data->engine.invalidate( item );
+
+                resetImplicitSize();
+                polish();
+
+                return true;
+            }
+
+            break;
+        }
         case QEvent::LayoutRequest:
         {
             invalidate();
@@ -10,8 +10,10 @@
 #include "QskSizePolicy.h"
 #include "QskQuick.h"
 
+#include <qhash.h>
 #include <qvector.h>
 
+#include <algorithm>
 #include <vector>
 #include <functional>
 
@@ -21,6 +23,21 @@ static inline qreal qskSegmentLength(
     return s[ end ].start - s[ start ].start + s[ end ].length;
 }
 
+static inline void qskInsertSlot( std::vector< int >& rowSlots, int slot )
+{
+    // usually appending, as new elements get the highest slot
+    const auto it = std::lower_bound( rowSlots.begin(), rowSlots.end(), slot );
+    if ( it == rowSlots.end() || *it != slot )
+        rowSlots.insert( it, slot );
+}
+
+static inline void qskRemoveSlot( std::vector< int >& rowSlots, int slot )
+{
+    const auto it = std::lower_bound( rowSlots.begin(), rowSlots.end(), slot );
+    if ( it != rowSlots.end() && *it == slot )
+        rowSlots.erase( it );
+}
+
 namespace
 {
     class Settings
@@ -161,6 +178,154 @@ namespace
     };
 }
 
+namespace
+{
+    /*
+        Counting the elements that end in a row/column, so that
+        the dimensions of the grid can be updated when inserting/removing
+        elements without having to iterate over all of them.
+     */
+    class Extents
+    {
+      public:
+        inline int maxPosition() const
+        {
+            return static_cast< int >( m_counts.size() ) - 1;
+        }
+
+        void add( int pos )
+        {
+            if ( pos >= static_cast< int >( m_counts.size() ) )
+                m_counts.resize( pos + 1, 0 );
+
+            m_counts[ pos ]++;
+        }
+
+        void remove( int pos )
+        {
+            if ( pos < 0 || pos >= static_cast< int >( m_counts.size() ) )
+                return;
+
+            if ( m_counts[ pos ] > 0 )
+                m_counts[ pos ]--;
+
+            while ( !m_counts.empty() && m_counts.back() == 0 )
+                m_counts.pop_back();
+        }
+
+        inline void clear()
+        {
+            m_counts.clear();
+        }
+
+      private:
+        std::vector< int > m_counts;
+    };
+}
+
+namespace
+{
+    /*
+        The index of an element shifts, when removing elements in front
+        of it. To avoid having to update the row index for all following
+        elements, removed elements are kept as gaps in their slots, until
+        there are too many of them. Counting the valid slots in a
+        Fenwick tree allows mapping between indexes and slots in O(log n).
+     */
+    class Slots
+    {
+      public:
+        inline int count() const
+        {
+            return m_count;
+        }
+
+        inline int size() const
+        {
+            return static_cast< int >( m_tree.size() );
+        }
+
+        inline bool hasGaps() const
+        {
+            return m_count < size();
+        }
+
+        void append()
+        {
+            const int i = size() + 1; // Fenwick indexes are 1 based
+
+            m_tree.push_back( 1 + sum( i - 1 ) - sum( i - ( i & -i ) ) );
+            m_count++;
+        }
+
+        void remove( int slot )
+        {
+            for ( int i = slot + 1; i <= size(); i += i & -i )
+                m_tree[ i - 1 ]--;
+
+            m_count--;
+        }
+
+        void reset( int count )
+        {
+            m_tree.resize( count );
+
+            for ( int i = 1; i <= count; i++ )
+                m_tree[ i - 1 ] = i & -i;
+
+            m_count = count;
+        }
+
+        inline int indexOf( int slot ) const
+        {
+            return hasGaps() ? sum( slot ) : slot;
+        }
+
+        int slotAt( int index ) const
+        {
+            if ( !hasGaps() )
+                return index;
+
+            // the slot, where sum( slot ) == index and slot is valid
+
+            const int n = size();
+
+            int slot = 0;
+            int remaining = index + 1;
+
+            int step = 1;
+            while ( 2 * step <= n )
+                step *= 2;
+
+            for ( ; step > 0; step /= 2 )
+            {
+                const int next = slot + step;
+                if ( next <= n && m_tree[ next - 1 ] < remaining )
+                {
+                    slot = next;
+                    remaining -= m_tree[ next - 1 ];
+                }
+            }
+
+            return slot;
+        }
+
+      private:
+        int sum( int slotCount ) const
+        {
+            int value = 0;
+
+            for ( int i = slotCount; i > 0; i -= i & -i )
+                value += m_tree[ i - 1 ];
+
+            return value;
+        }
+
+        int m_count = 0;
+        std::vector< int > m_tree;
+    };
+}
+
 namespace
 {
     inline QskLayoutMetrics qskItemMetrics(
@@ -187,9 +352,16 @@ namespace
 
         QRect minimumGrid() const;
 
+        // removed elements are kept as gaps, until the elements get compacted
+        void setRemoved();
+        bool isRemoved() const;
+
         bool isIgnored() const;
         QskLayoutChain::CellData cell( Qt::Orientation ) const;
 
+        QskLayoutMetrics metrics( Qt::Orientation, qreal constraint ) const;
+        void invalidateMetrics();
+
         void transpose();
 
       private:
@@ -202,6 +374,10 @@ namespace
 
         QRect m_grid;
         bool m_isSpacer;
+
+        // the unconstrained metrics of the item
+        mutable int m_validMetrics = 0;
+        mutable QskLayoutMetrics m_metrics[ 2 ];
     };
 
     class ElementsVector : public std::vector< Element >
@@ -229,7 +405,11 @@ Element::Element( const QSizeF& spacing, const QRect& grid )
 Element::Element( const Element& other )
     : m_grid( other.m_grid )
     , m_isSpacer (other.m_isSpacer )
+    , m_validMetrics( other.m_validMetrics )
 {
+    m_metrics[0] = other.m_metrics[0];
+    m_metrics[1] = other.m_metrics[1];
+
     if ( other.m_isSpacer )
         m_spacing = other.m_spacing;
     else
@@ -247,6 +427,10 @@ Element& Element::operator=( const Element& other )
 
     m_grid = other.m_grid;
 
+    m_validMetrics = other.m_validMetrics;
+    m_metrics[0] = other.m_metrics[0];
+    m_metrics[1] = other.m_metrics[1];
+
     return *this;
 }
 
@@ -276,8 +460,23 @@ QRect Element::minimumGrid() const
         qMax( m_grid.width(), 1 ), qMax( m_grid.height(), 1 ) );
 }
 
+void Element::setRemoved()
+{
+    m_item = nullptr;
+    m_isSpacer = false;
+    m_grid = QRect();
+}
+
+inline bool Element::isRemoved() const
+{
+    return !m_isSpacer && ( m_item == nullptr );
+}
+
 bool Element::isIgnored() const
 {
+    if ( isRemoved() )
+        return true;
+
     return !( m_isSpacer || qskIsVisibleToLayout( m_item ) );
 }
 
@@ -308,6 +507,27 @@ QskLayoutChain::CellData Element::cell( Qt::Orientation orientation ) const
     return cell;
 }
 
+QskLayoutMetrics Element::metrics( Qt::Orientation orientation, qreal constraint ) const
+{
+    if ( constraint >= 0.0 )
+        return qskItemMetrics( item(), orientation, constraint );
+
+    const int index = ( orientation == Qt::Horizontal ) ? 0 : 1;
+
+    if ( !( m_validMetrics & ( 1 << index ) ) )
+    {
+        m_metrics[ index ] = qskItemMetrics( item(), orientation, -1.0 );
+        m_validMetrics |= ( 1 << index );
+    }
+
+    return m_metrics[ index ];
+}
+
+inline void Element::invalidateMetrics()
+{
+    m_validMetrics = 0;
+}
+
 void Element::transpose()
 {
     m_grid.setRect( m_grid.top(), m_grid.left(),
@@ -319,10 +539,11 @@ class QskGridLayoutEngine::PrivateData
   public:
     inline Element* elementAt( int index ) const
     {
-        if ( index < 0 || index >= this->elements.count() )
+        if ( index < 0 || index >= validSlots.count() )
             return nullptr;
 
-        return const_cast< Element* >( &this->elements[index] );
+        const int slot = validSlots.slotAt( index );
+        return const_cast< Element* >( &this->elements[ slot ] );
     }
 
     int insertElement( QQuickItem* item, QSizeF spacing, QRect grid )
@@ -337,6 +558,7 @@ class QskGridLayoutEngine::PrivateData
         if ( item )
         {
             elements.push_back( Element( item, grid ) );
+            itemSlots.insert( item, elements.count() - 1 );
         }
         else
         {
@@ -349,12 +571,97 @@ class QskGridLayoutEngine::PrivateData
             elements.push_back( Element( spacing, grid ) );
         }
 
-        grid = effectiveGrid( elements.back() );
+        validSlots.append();
+
+        addExtent( elements.back() );
+        addToRowIndex( elements.count() - 1 );
+
+        updateCounts();
+
+        return validSlots.count() - 1;
+    }
+
+    void removeElement( int index )
+    {
+        const int slot = validSlots.slotAt( index );
+        auto& element = elements[ slot ];
+
+        removeExtent( element );
+        removeFromRowIndex( slot );
+
+        if ( const auto item = element.item() )
+            itemSlots.remove( item, slot );
+
+        element.setRemoved();
+        validSlots.remove( slot );
+
+        if ( 2 * validSlots.count() < validSlots.size() )
+            compact();
+
+        updateCounts();
+    }
+
+    void setElementGrid( int index, const QRect& grid )
+    {
+        const int slot = validSlots.slotAt( index );
+        auto& element = elements[ slot ];
+
+        removeExtent( element );
+        removeFromRowIndex( slot );
+
+        element.setGrid( grid );
+
+        addExtent( element );
+        addToRowIndex( slot );
+
+        updateCounts();
+    }
+
+    int indexOf( const QQuickItem* item ) const
+    {
+        /*
+            In case of an item being inserted more than once,
+            the last one is found - like with the reverse search
+            we had before.
+         */
+        int slot = -1;
+
+        for ( auto it = itemSlots.constFind( item );
+            it != itemSlots.constEnd() && it.key() == item; ++it )
+        {
+            slot = qMax( slot, it.value() );
+        }
+
+        return ( slot >= 0 ) ? validSlots.indexOf( slot ) : -1;
+    }
+
+    int indexAt( int row, int column ) const
+    {
+        if ( row < 0 || row >= rowCount || column < 0 || column >= columnCount )
+            return -1;
+
+        /*
+            The elements are stored in the row index in order of their slots,
+            so the first one containing the cell is the one, that
+            would have been found by iterating over all elements.
+         */
+
+        int slot = -1;
+
+        if ( row < static_cast< int >( rowIndex.size() ) )
+            slot = firstSlotAt( rowIndex[ row ], row, column );
+
+        const int stretchedSlot = firstSlotAt( stretchedRowIndex, row, column );
+        if ( stretchedSlot >= 0 && ( slot < 0 || stretchedSlot < slot ) )
+            slot = stretchedSlot;
 
-        rowCount = qMax( rowCount, grid.bottom() + 1 );
-        columnCount = qMax( columnCount, grid.right() + 1 );
+        return ( slot >= 0 ) ? validSlots.indexOf( slot ) : -1;
+    }
 
-        return this->elements.count() - 1;
+    void updateCounts()
+    {
+        rowCount = qMax( rowSettings.maxPosition(), rowExtents.maxPosition() ) + 1;
+        columnCount = qMax( columnSettings.maxPosition(), columnExtents.maxPosition() ) + 1;
     }
 
     QRect effectiveGrid( const Element& element ) const
@@ -377,13 +684,147 @@ class QskGridLayoutEngine::PrivateData
             ? that->columnSettings : that->rowSettings;
     }
 
-    ElementsVector elements;
+    void clear()
+    {
+        elements.clear();
+        validSlots.reset( 0 );
+        itemSlots.clear();
+
+        rowIndex.clear();
+        stretchedRowIndex.clear();
+
+        rowSettings.clear();
+        columnSettings.clear();
+
+        rowExtents.clear();
+        columnExtents.clear();
+
+        updateCounts();
+    }
+
+    void transpose()
+    {
+        for ( auto& element : elements )
+            element.transpose();
+
+        qSwap( columnSettings, rowSettings );
+        qSwap( columnExtents, rowExtents );
+
+        // the rows have become columns
+        compact();
+
+        updateCounts();
+    }
+
+    ElementsVector elements; // including the gaps of removed elements
+    Slots validSlots;
 
     Settings rowSettings;
     Settings columnSettings;
 
+    Extents rowExtents;
+    Extents columnExtents;
+
     int rowCount = 0;
     int columnCount = 0;
+
+  private:
+    inline void addExtent( const Element& element )
+    {
+        const auto grid = element.minimumGrid();
+
+        rowExtents.add( grid.bottom() );
+        columnExtents.add( grid.right() );
+    }
+
+    inline void removeExtent( const Element& element )
+    {
+        const auto grid = element.minimumGrid();
+
+        rowExtents.remove( grid.bottom() );
+        columnExtents.remove( grid.right() );
+    }
+
+    void addToRowIndex( int slot )
+    {
+        const auto grid = elements[ slot ].grid();
+
+        if ( grid.height() <= 0 )
+        {
+            qskInsertSlot( stretchedRowIndex, slot );
+        }
+        else
+        {
+            if ( grid.bottom() >= static_cast< int >( rowIndex.size() ) )
+                rowIndex.resize( grid.bottom() + 1 );
+
+            for ( int row = grid.top(); row <= grid.bottom(); row++ )
+                qskInsertSlot( rowIndex[ row ], slot );
+        }
+    }
+
+    void removeFromRowIndex( int slot )
+    {
+        const auto grid = elements[ slot ].grid();
+
+        if ( grid.height() <= 0 )
+        {
+            qskRemoveSlot( stretchedRowIndex, slot );
+        }
+        else
+        {
+            for ( int row = grid.top(); row <= grid.bottom(); row++ )
+                qskRemoveSlot( rowIndex[ row ], slot );
+        }
+    }
+
+    int firstSlotAt( const std::vector< int >& rowSlots, int row, int column ) const
+    {
+        for ( const auto slot : rowSlots )
+        {
+            const auto grid = effectiveGrid( elements[ slot ] );
+            if ( grid.contains( column, row ) )
+                return slot;
+        }
+
+        return -1;
+    }
+
+    void compact()
+    {
+        /*
+            Removing the gaps and rebuilding the index in O(n),
+            what happens rarely enough to be amortized
+         */
+        elements.erase( std::remove_if( elements.begin(), elements.end(),
+            []( const Element& element ) { return element.isRemoved(); } ),
+            elements.end() );
+
+        validSlots.reset( elements.count() );
+
+        itemSlots.clear();
+        rowIndex.clear();
+        stretchedRowIndex.clear();
+
+        for ( int slot = 0; slot < elements.count(); slot++ )
+        {
+            if ( const auto item = elements[ slot ].item() )
+                itemSlots.insert( item, slot );
+
+            addToRowIndex( slot );
+        }
+    }
+
+    // the slots of the items
+    QMultiHash< const QQuickItem*, int > itemSlots;
+
+    /*
+        The slots of the elements for each row in ascending order.
+        Elements, that are stretched to the last row, are stored
+        separately as the number of rows might change.
+     */
+    std::vector< std::vector< int > > rowIndex;
+    std::vector< int > stretchedRowIndex;
 };
 
 QskGridLayoutEngine::QskGridLayoutEngine()
@@ -397,7 +838,7 @@ QskGridLayoutEngine::~QskGridLayoutEngine()
 
 int QskGridLayoutEngine::count() const
 {
-    return m_data->elements.count();
+    return m_data->validSlots.count();
 }
 
 bool QskGridLayoutEngine::setStretchFactor(
@@ -412,16 +853,7 @@ bool QskGridLayoutEngine::setStretchFactor(
     if ( !m_data->settings( orientation ).setStretchAt( pos, stretch ) )
         return false;
 
-    if ( orientation == Qt::Horizontal )
-    {
-        if ( pos >= m_data->columnCount )
-            m_data->columnCount = pos + 1;
-    }
-    else
-    {
-        if ( pos >= m_data->rowCount )
-            m_data->rowCount = pos + 1;
-    }
+    m_data->updateCounts();
 
     invalidate();
     return true;
@@ -440,8 +872,7 @@ bool QskGridLayoutEngine::setRowSizeHint(
     if ( !m_data->rowSettings.setMetricAt( row, which, height ) )
         return false;
 
-    if ( row >= m_data->rowCount )
-        m_data->rowCount = row + 1;
+    m_data->updateCounts();
 
     invalidate();
     return true;
@@ -459,8 +890,7 @@ bool QskGridLayoutEngine::setColumnSizeHint(
     if ( !m_data->columnSettings.setMetricAt( column, which, width ) )
         return false;
 
-    if ( column >= m_data->columnCount )
-        m_data->columnCount = column + 1;
+    m_data->updateCounts();
 
     invalidate();
     return true;
@@ -485,34 +915,10 @@ int QskGridLayoutEngine::insertSpacer( const QSizeF& spacing, const QRect& grid
 
 bool QskGridLayoutEngine::removeAt( int index )
 {
-    const auto elementAt = m_data->elementAt( index );
-    if ( elementAt == nullptr )
+    if ( m_data->elementAt( index ) == nullptr )
         return false;
 
-    const auto grid = elementAt->minimumGrid();
-
-    auto& elements = m_data->elements;
-    elements.erase( elements.begin() + index );
-
-    // doing a lazy recalculation instead ??
-
-    if ( grid.bottom() >= m_data->rowCount
-        || grid.right() >= m_data->columnCount )
-    {
-        int maxRow = m_data->rowSettings.maxPosition();
-        int maxColumn = m_data->columnSettings.maxPosition();
-
-        for ( const auto& element : elements )
-        {
-            const auto minGrid = element.minimumGrid();
-
-            maxRow = qMax( maxRow, minGrid.bottom() );
-            maxColumn = qMax( maxColumn, minGrid.right() );
-        }
-
-        m_data->rowCount = maxRow + 1;
-        m_data->columnCount = maxColumn + 1;
-    }
+    m_data->removeElement( index );
 
     invalidate();
     return true;
@@ -520,11 +926,7 @@ bool QskGridLayoutEngine::removeAt( int index )
 
 bool QskGridLayoutEngine::clear()
 {
-    m_data->elements.clear();
-    m_data->rowSettings.clear();
-    m_data->columnSettings.clear();
-
-    m_data->rowCount = m_data->columnCount = 0;
+    m_data->clear();
 
     invalidate();
     return true;
@@ -532,17 +934,7 @@ bool QskGridLayoutEngine::clear()
 
 int QskGridLayoutEngine::indexAt( int row, int column ) const
 {
-    if ( row < m_data->rowCount && column < m_data->columnCount )
-    {
-        for ( uint i = 0; i < m_data->elements.size(); i++ )
-        {
-            const auto grid = m_data->effectiveGrid( m_data->elements[i] );
-            if ( grid.contains( column, row ) )
-                return i;
-        }
-    }
-
-    return -1;
+    return m_data->indexAt( row, column );
 }
 
 QQuickItem* QskGridLayoutEngine::itemAt( int index ) const
@@ -560,21 +952,10 @@ QskSizePolicy QskGridLayoutEngine::sizePolicyAt( int index ) const
 
 int QskGridLayoutEngine::indexOf( const QQuickItem* item ) const
 {
-    if ( item )
-    {
-        /*
-           indexOf is often called after inserting an item to
-           set additinal properties. So we search in reverse order
-         */
-
-        for ( int i = count() - 1; i >= 0; --i )
-        {
-            if ( itemAt( i ) == item )
-                return i;
-        }
-    }
+    if ( item == nullptr )
+        return -1;
 
-    return -1;
+    return m_data->indexOf( item );
 }
 
 QSizeF QskGridLayoutEngine::spacerAt( int index ) const
@@ -596,7 +977,7 @@ bool QskGridLayoutEngine::setGridAt( int index, const QRect& grid )
     {
         if ( element->grid() != grid )
         {
-            element->setGrid( grid );
+            m_data->setElementGrid( index, grid );
             invalidate();
 
             return true;
@@ -624,6 +1005,24 @@ QRect QskGridLayoutEngine::effectiveGridAt( int index ) const
 
 void QskGridLayoutEngine::invalidateElementCache()
 {
+    for ( auto& element : m_data->elements )
+        element.invalidateMetrics();
+}
+
+bool QskGridLayoutEngine::invalidateItemCache( const QQuickItem* item )
+{
+    const auto& itemSlots = m_data->itemSlots;
+
+    bool found = false;
+
+    for ( auto it = itemSlots.constFind( item );
+        it != itemSlots.constEnd() && it.key() == item; ++it )
+    {
+        m_data->elements[ it.value() ].invalidateMetrics();
+        found = true;
+    }
+
+    return found;
 }
 
 void QskGridLayoutEngine::layoutItems()
@@ -639,7 +1038,7 @@ void QskGridLayoutEngine::layoutItems()
             const QskItemLayoutElement layoutElement( item );
 
             const auto rect = geometryAt( &layoutElement, grid );
-            if ( rect.size().isValid() )
+            if ( rect.size().isValid() && rect != qskItemGeometry( item ) )
                 qskSetItemGeometry( item, rect );
         }
     }
@@ -647,12 +1046,7 @@ void QskGridLayoutEngine::layoutItems()
 
 void QskGridLayoutEngine::transpose()
 {
-    for ( auto& element : m_data->elements )
-        element.transpose();
-
-    qSwap( m_data->columnSettings, m_data->rowSettings );
-    qSwap( m_data->columnCount, m_data->rowCount );
-
+    m_data->transpose();
     invalidate();
 }
 
@@ -666,12 +1060,19 @@ int QskGridLayoutEngine::effectiveCount(
 void QskGridLayoutEngine::setupChain( Qt::Orientation orientation,
     const QskLayoutChain::Segments& constraints, QskLayoutChain& chain ) const
 {
+    struct Span
+    {
+        const Element* element;
+        QRect grid;
+    };
+
     /*
         We collect all information from the simple elements first
-        before adding those that occupy more than one cell
+        before adding those that occupy more than one cell. The
+        effective grid of the postponed elements is kept, so that
+        each element is processed only once.
      */
-    QVarLengthArray< const Element* > postponed;
-    postponed.reserve( m_data->elements.count() );
+    QVarLengthArray< Span > postponed;
 
     for ( const auto& element : m_data->elements )
     {
@@ -691,13 +1092,13 @@ void QskGridLayoutEngine::setupChain( Qt::Orientation orientation,
             auto cell = element.cell( orientation );
 
             if ( element.item() )
-                cell.metrics = qskItemMetrics( element.item(), orientation, constraint );
+                cell.metrics = element.metrics( orientation, constraint );
 
             chain.expandCell( grid.top(), cell );
         }
         else
         {
-            postponed += &element;
+            postponed.append( { &element, grid } );
         }
     }
 
@@ -706,18 +1107,16 @@ void QskGridLayoutEngine::setupChain( Qt::Orientation orientation,
     for ( const auto& setting : settings.settings() )
         chain.shrinkCell( setting.position, setting.cell() );
 
-    for ( const auto element : postponed )
+    for ( const auto& span : postponed )
     {
-        auto grid = m_data->effectiveGrid( *element );
-        if ( orientation == Qt::Horizontal )
-            grid.setRect( grid.y(), grid.x(), grid.height(), grid.width() );
+        const auto& grid = span.grid;
 
         qreal constraint = -1.0;
         if ( !constraints.isEmpty() )
             constraint = qskSegmentLength( constraints, grid.left(), grid.right() );
 
-        auto cell = element->cell( orientation );
-        cell.metrics = qskItemMetrics( element->item(), orientation, constraint );
+        auto cell = span.element->cell( orientation );
+        cell.metrics = span.element->metrics( orientation, constraint );
 
         chain.expandCells( grid.top(), grid.height(), cell );
     }
@@ -60,6 +60,7 @@ class QSK_EXPORT QskGridLayoutEngine : public QskLayoutEngine2D
     int effectiveCount( Qt::Orientation ) const override;
 
     void invalidateElementCache() override;
+    bool invalidateItemCache( const QQuickItem* ) override;
 
     void setupChain( Qt::Orientation, const QskLayoutChain::Segments&,
         QskLayoutChain& ) const override final;
@@ -10,8 +10,73 @@
 
 #include <qguiapplication.h>
 
+static quint64 qskHintCacheHits = 0;
+static quint64 qskHintCacheMisses = 0;
+
 namespace
 {
+    /*
+        Nested height-for-width layouts are asking for the same constraints
+        over and over. So we remember the most recent results.
+     */
+    class HintCache
+    {
+      public:
+        inline void clear()
+        {
+            m_count = 0;
+        }
+
+        bool find( Qt::SizeHint which, const QSizeF& constraint, QSizeF& hint )
+        {
+            for ( int i = 0; i < m_count; i++ )
+            {
+                if ( ( m_entries[i].which == which )
+                    && ( m_entries[i].constraint == constraint ) )
+                {
+                    const auto entry = m_entries[i];
+
+                    // moving it to the front
+                    for ( int j = i; j > 0; j-- )
+                        m_entries[j] = m_entries[j - 1];
+
+                    m_entries[0] = entry;
+
+                    hint = entry.hint;
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        void insert( Qt::SizeHint which,
+            const QSizeF& constraint, const QSizeF& hint )
+        {
+            // the least recently used entry drops out
+
+            m_count = qMin( m_count + 1, Capacity );
+
+            for ( int i = m_count - 1; i > 0; i-- )
+                m_entries[i] = m_entries[i - 1];
+
+            m_entries[0] = { which, constraint, hint };
+        }
+
+      private:
+        enum { Capacity = 8 };
+
+        struct Entry
+        {
+            Qt::SizeHint which;
+            QSizeF constraint;
+            QSizeF hint;
+        };
+
+        Entry m_entries[ Capacity ];
+        int m_count = 0;
+    };
+
     class LayoutData
     {
       public:
@@ -74,6 +139,8 @@ class QskLayoutEngine2D::PrivateData
 
     const LayoutData* layoutData = nullptr;
 
+    HintCache hintCache;
+
     unsigned int defaultAlignment : 8;
     unsigned int extraSpacingAt : 4;
     unsigned int visualDirection : 4;
@@ -282,6 +349,16 @@ QSizeF QskLayoutEngine2D::sizeHint(
     if ( effectiveCount( Qt::Horizontal ) <= 0 )
         return QSizeF( 0.0, 0.0 );
 
+    QSizeF hint;
+
+    if ( m_data->hintCache.find( which, constraint, hint ) )
+    {
+        qskHintCacheHits++;
+        return hint;
+    }
+
+    qskHintCacheMisses++;
+
     auto requestType = constraintType();
 
     switch ( requestType )
@@ -362,17 +439,27 @@ QSizeF QskLayoutEngine2D::sizeHint(
 
     m_data->blockInvalidate = false;
 
-    QSizeF hint;
-
     if ( constraint.width() <= 0.0 )
         hint.rwidth() = columnChain.boundingMetrics().metric( which );
 
     if ( constraint.height() <= 0.0 )
         hint.rheight() = rowChain.boundingMetrics().metric( which );
 
+    m_data->hintCache.insert( which, constraint, hint );
+
     return hint;
 }
 
+quint64 QskLayoutEngine2D::sizeHintCacheHits()
+{
+    return qskHintCacheHits;
+}
+
+quint64 QskLayoutEngine2D::sizeHintCacheMisses()
+{
+    return qskHintCacheMisses;
+}
+
 void QskLayoutEngine2D::setupChain( Qt::Orientation orientation ) const
 {
     setupChain( orientation, QskLayoutChain::Segments() );
@@ -454,6 +541,9 @@ void QskLayoutEngine2D::invalidate( int what )
     if ( m_data->blockInvalidate )
         return;
 
+    if ( what & ( ElementCache | LayoutCache ) )
+        m_data->hintCache.clear();
+
     if ( what & ElementCache )
     {
         m_data->constraintType = -1;
@@ -471,6 +561,33 @@ void QskLayoutEngine2D::invalidate( int what )
     }
 }
 
+void QskLayoutEngine2D::invalidate( const QQuickItem* item )
+{
+    if ( m_data->blockInvalidate )
+        return;
+
+    if ( item && invalidateItemCache( item ) )
+    {
+        /*
+            The chains have to be set up again, but only the metrics
+            of the item need to be requested. The constraint type
+            might have changed with the size policy of the item.
+         */
+        m_data->constraintType = -1;
+        invalidate( LayoutCache );
+    }
+    else
+    {
+        invalidate( ElementCache | LayoutCache );
+    }
+}
+
+bool QskLayoutEngine2D::invalidateItemCache( const QQuickItem* )
+{
+    // no item specific caches
+    return false;
+}
+
 QskSizePolicy::ConstraintType QskLayoutEngine2D::constraintType() const
 {
     if ( m_data->constraintType < 0 )
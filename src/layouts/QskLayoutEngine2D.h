@@ -14,6 +14,7 @@
 #include <memory>
 
 class QskLayoutElement;
+class QQuickItem;
 
 class QSK_EXPORT QskLayoutEngine2D
 {
@@ -42,11 +43,18 @@ class QSK_EXPORT QskLayoutEngine2D
 
     void invalidate();
 
+    // invalidating the cached values of a single item only
+    void invalidate( const QQuickItem* );
+
     qreal widthForHeight( qreal height ) const;
     qreal heightForWidth( qreal width ) const;
 
     QSizeF sizeHint( Qt::SizeHint, const QSizeF& constraint ) const;
 
+    // accumulated statistics of the size hint caches of all engines
+    static quint64 sizeHintCacheHits();
+    static quint64 sizeHintCacheMisses();
+
     void setGeometries( const QRectF& );
 
   protected:
@@ -69,6 +77,7 @@ class QSK_EXPORT QskLayoutEngine2D
     virtual int effectiveCount( Qt::Orientation ) const = 0;
 
     virtual void invalidateElementCache() = 0;
+    virtual bool invalidateItemCache( const QQuickItem* );
     QskSizePolicy::ConstraintType constraintType() const;
 
     virtual QskSizePolicy sizePolicyAt( int index ) const = 0;
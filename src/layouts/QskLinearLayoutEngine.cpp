@@ -11,6 +11,7 @@
 #include "QskQuick.h"
 
 #include <qvector.h>
+#include <qhash.h>
 
 namespace
 {
@@ -41,6 +42,9 @@ namespace
         QskLayoutChain::CellData cell(
             Qt::Orientation, bool isLayoutOrientation ) const;
 
+        QskLayoutMetrics metrics( Qt::Orientation, qreal constraint ) const;
+        void invalidateMetrics();
+
       private:
 
         union
@@ -51,6 +55,10 @@ namespace
 
         int m_stretch = -1;
         bool m_isSpacer;
+
+        // the unconstrained metrics of the item
+        mutable int m_validMetrics = 0;
+        mutable QskLayoutMetrics m_metrics[ 2 ];
     };
 
     class ElementsVector : public std::vector< Element >
@@ -76,7 +84,11 @@ Element::Element( qreal spacing )
 Element::Element( const Element& other )
     : m_stretch( other.m_stretch )
     , m_isSpacer( other.m_isSpacer )
+    , m_validMetrics( other.m_validMetrics )
 {
+    m_metrics[0] = other.m_metrics[0];
+    m_metrics[1] = other.m_metrics[1];
+
     if ( other.m_isSpacer )
         m_spacing = other.m_spacing;
     else
@@ -94,6 +106,10 @@ Element& Element::operator=( const Element& other )
 
     m_stretch = other.m_stretch;
 
+    m_validMetrics = other.m_validMetrics;
+    m_metrics[0] = other.m_metrics[0];
+    m_metrics[1] = other.m_metrics[1];
+
     return *this;
 }
 
@@ -160,6 +176,27 @@ QskLayoutChain::CellData Element::cell(
     return cell;
 }
 
+QskLayoutMetrics Element::metrics( Qt::Orientation orientation, qreal constraint ) const
+{
+    if ( constraint >= 0.0 )
+        return qskItemMetrics( item(), orientation, constraint );
+
+    const int index = ( orientation == Qt::Horizontal ) ? 0 : 1;
+
+    if ( !( m_validMetrics & ( 1 << index ) ) )
+    {
+        m_metrics[ index ] = qskItemMetrics( item(), orientation, -1.0 );
+        m_validMetrics |= ( 1 << index );
+    }
+
+    return m_metrics[ index ];
+}
+
+inline void Element::invalidateMetrics()
+{
+    m_validMetrics = 0;
+}
+
 class QskLinearLayoutEngine::PrivateData
 {
   public:
@@ -168,9 +205,33 @@ class QskLinearLayoutEngine::PrivateData
         : dimension( dimension )
         , sumIgnored( -1 )
         , orientation( orientation )
+        , dirtyItemIndexes( false )
     {
     }
 
+    const QMultiHash< const QQuickItem*, int >& itemIndexes() const
+    {
+        if ( dirtyItemIndexes )
+        {
+            /*
+                Inserting/removing in the middle shifts the indexes
+                of all following elements. Instead of updating
+                them each time we rebuild the hash, when needed.
+             */
+            itemIndexTable.clear();
+
+            for ( int i = 0; i < elements.count(); i++ )
+            {
+                if ( const auto item = elements[i].item() )
+                    itemIndexTable.insert( item, i );
+            }
+
+            dirtyItemIndexes = false;
+        }
+
+        return itemIndexTable;
+    }
+
     inline Element* elementAt( int index ) const
     {
         if ( ( index < 0 ) || ( index >= this->elements.count() ) )
@@ -181,10 +242,15 @@ class QskLinearLayoutEngine::PrivateData
 
     ElementsVector elements;
 
+    // the indexes of the items
+    mutable QMultiHash< const QQuickItem*, int > itemIndexTable;
+
     uint dimension;
 
     mutable int sumIgnored : 30;
     unsigned int orientation : 2;
+
+    mutable bool dirtyItemIndexes : 1;
 };
 
 QskLinearLayoutEngine::QskLinearLayoutEngine(
@@ -272,14 +338,18 @@ int QskLinearLayoutEngine::insertItem( QQuickItem* item, int index )
 {
     auto& elements = m_data->elements;
 
-    if ( index < 0 || index > count() )
+    if ( index < 0 || index >= count() )
     {
         index = elements.count();
         elements.emplace_back( item );
+
+        if ( item && !m_data->dirtyItemIndexes )
+            m_data->itemIndexTable.insert( item, index );
     }
     else
     {
         elements.emplace( elements.begin() + index, item );
+        m_data->dirtyItemIndexes = true;
     }
 
     invalidate();
@@ -292,7 +362,7 @@ int QskLinearLayoutEngine::insertSpacerAt( int index, qreal spacing )
 
     auto& elements = m_data->elements;
 
-    if ( index < 0 || index > count() )
+    if ( index < 0 || index >= count() )
     {
         index = elements.count();
         elements.emplace_back( spacing );
@@ -300,6 +370,7 @@ int QskLinearLayoutEngine::insertSpacerAt( int index, qreal spacing )
     else
     {
         elements.emplace( elements.begin() + index, spacing );
+        m_data->dirtyItemIndexes = true;
     }
 
     invalidate( LayoutCache );
@@ -322,6 +393,19 @@ bool QskLinearLayoutEngine::removeAt( int index )
     if ( itemType > QskSizePolicy::Unconstrained )
         invalidationMode |= ElementCache;
 
+    if ( index == count() - 1 )
+    {
+        if ( const auto item = element->item() )
+        {
+            if ( !m_data->dirtyItemIndexes )
+                m_data->itemIndexTable.remove( item, index );
+        }
+    }
+    else
+    {
+        m_data->dirtyItemIndexes = true;
+    }
+
     m_data->elements.erase( m_data->elements.begin() + index );
     invalidate( invalidationMode );
 
@@ -334,6 +418,10 @@ bool QskLinearLayoutEngine::clear()
         return false;
 
     m_data->elements.clear();
+
+    m_data->itemIndexTable.clear();
+    m_data->dirtyItemIndexes = false;
+
     invalidate();
 
     return true;
@@ -346,21 +434,25 @@ QskSizePolicy QskLinearLayoutEngine::sizePolicyAt( int index ) const
 
 int QskLinearLayoutEngine::indexOf( const QQuickItem* item ) const
 {
+    /*
+        In case of an item being inserted more than once,
+        the last one is found - like with the reverse search
+        we had before.
+     */
+    int index = -1;
+
     if ( item )
     {
-        /*
-           indexOf is often called after inserting an item to
-           set additinal properties. So we search in reverse order
-         */
+        const auto& itemIndexes = m_data->itemIndexes();
 
-        for ( int i = count() - 1; i >= 0; --i )
+        for ( auto it = itemIndexes.constFind( item );
+            it != itemIndexes.constEnd() && it.key() == item; ++it )
         {
-            if ( itemAt( i ) == item )
-                return i;
+            index = qMax( index, it.value() );
         }
     }
 
-    return -1;
+    return index;
 }
 
 QQuickItem* QskLinearLayoutEngine::itemAt( int index ) const
@@ -398,7 +490,7 @@ void QskLinearLayoutEngine::layoutItems()
                 const QskItemLayoutElement layoutElement( item );
 
                 const auto rect = geometryAt( &layoutElement, grid );
-                if ( rect.size().isValid() )
+                if ( rect.size().isValid() && rect != qskItemGeometry( item ) )
                     qskSetItemGeometry( item, rect );
             }
         }
@@ -459,6 +551,31 @@ int QskLinearLayoutEngine::effectiveCount() const
 void QskLinearLayoutEngine::invalidateElementCache()
 {
     m_data->sumIgnored = -1;
+
+    for ( auto& element : m_data->elements )
+        element.invalidateMetrics();
+}
+
+bool QskLinearLayoutEngine::invalidateItemCache( const QQuickItem* item )
+{
+    const auto& itemIndexes = m_data->itemIndexes();
+
+    bool found = false;
+
+    for ( auto it = itemIndexes.constFind( item );
+        it != itemIndexes.constEnd() && it.key() == item; ++it )
+    {
+        m_data->elements[ it.value() ].invalidateMetrics();
+        found = true;
+    }
+
+    if ( found )
+    {
+        // the item might have become ignored
+        m_data->sumIgnored = -1;
+    }
+
+    return found;
 }
 
 void QskLinearLayoutEngine::setupChain( Qt::Orientation orientation,
@@ -482,7 +599,7 @@ void QskLinearLayoutEngine::setupChain( Qt::Orientation orientation,
         auto cell = element.cell( orientation, isLayoutOrientation );
 
         if ( element.item() )
-            cell.metrics = qskItemMetrics( element.item(), orientation, constraint );
+            cell.metrics = element.metrics( orientation, constraint );
 
         chain.expandCell( index2, cell );
 
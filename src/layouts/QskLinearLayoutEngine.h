@@ -57,6 +57,7 @@ class QSK_EXPORT QskLinearLayoutEngine : public QskLayoutEngine2D
     int effectiveCount( Qt::Orientation ) const override;
 
     void invalidateElementCache() override;
+    bool invalidateItemCache( const QQuickItem* ) override;
 
     virtual void setupChain( Qt::Orientation, const QskLayoutChain::Segments&,
         QskLayoutChain& ) const override final;
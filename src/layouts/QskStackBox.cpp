@@ -10,14 +10,39 @@
 
 #include <QPointer>
 
+namespace
+{
+    class Page
+    {
+      public:
+        QskStackBox::PageFactory factory; // invalid for items being inserted
+        Qt::Alignment alignment;
+    };
+}
+
+static inline int qskIndexDistance( int index1, int index2, int count )
+{
+    // the animators treat the first and the last index as neighbours
+    const int distance = qAbs( index1 - index2 );
+    return qMin( distance, count - distance );
+}
+
 class QskStackBox::PrivateData
 {
   public:
-    QVector< QQuickItem* > items;
+    QVector< QQuickItem* > items; // nullptr, when a page has not been loaded
+    QVector< Page > pages;
+
     QPointer< QskStackBoxAnimator > animator;
 
     int currentIndex = -1;
     Qt::Alignment defaultAlignment = Qt::AlignLeft | Qt::AlignVCenter;
+
+    int preloadDistance = 0;
+    int unloadDistance = -1;
+
+    // blocking autoAddItem for pages, that are created with the box as parent
+    bool isLoading = false;
 };
 
 QskStackBox::QskStackBox( QQuickItem* parent )
@@ -30,6 +55,15 @@ QskStackBox::QskStackBox( bool autoAddChildren, QQuickItem* parent )
     , m_data( new PrivateData() )
 {
     setAutoAddChildren( autoAddChildren );
+
+    connect( this, &QskStackBox::transientIndexChanged, this,
+        [this]( qreal index )
+        {
+            // unloading the pages, that have been kept for the transition
+            if ( index == m_data->currentIndex )
+                updatePages();
+        }
+    );
 }
 
 QskStackBox::~QskStackBox()
@@ -144,6 +178,10 @@ void QskStackBox::setCurrentIndex( int index )
 
     if ( window() && isVisible() && isInitiallyPainted() && animator )
     {
+        // lazy pages involved in the transition
+        loadItem( m_data->currentIndex );
+        loadItem( index );
+
         // start the animation
         animator->setStartIndex( m_data->currentIndex );
         animator->setEndIndex( index );
@@ -153,7 +191,7 @@ void QskStackBox::setCurrentIndex( int index )
     else
     {
         auto item1 = itemAtIndex( m_data->currentIndex );
-        auto item2 = itemAtIndex( index );
+        auto item2 = loadItem( index );
 
         if ( item1 )
             item1->setVisible( false );
@@ -163,6 +201,8 @@ void QskStackBox::setCurrentIndex( int index )
     }
 
     m_data->currentIndex = index;
+    updatePages();
+
     polish();
 
     Q_EMIT currentIndexChanged( m_data->currentIndex );
@@ -225,6 +265,7 @@ void QskStackBox::insertItem( int index, QQuickItem* item )
             }
 
             m_data->items.removeAt( oldIndex );
+            m_data->pages.removeAt( oldIndex );
         }
     }
 
@@ -232,6 +273,7 @@ void QskStackBox::insertItem( int index, QQuickItem* item )
         index = itemCount();
 
     m_data->items.insert( index, item );
+    m_data->pages.insert( index, Page() );
 
     const int oldCurrentIndex = m_data->currentIndex;
 
@@ -264,6 +306,177 @@ void QskStackBox::insertItem(
     insertItem( index, item );
 }
 
+void QskStackBox::addPage( const PageFactory& factory, Qt::Alignment alignment )
+{
+    insertPage( -1, factory, alignment );
+}
+
+void QskStackBox::insertPage( int index,
+    const PageFactory& factory, Qt::Alignment alignment )
+{
+    if ( !factory )
+        return;
+
+    if ( ( index < 0 ) || ( index >= itemCount() ) )
+        index = itemCount();
+
+    m_data->items.insert( index, nullptr );
+    m_data->pages.insert( index, { factory, alignment } );
+
+    const int oldCurrentIndex = m_data->currentIndex;
+
+    /*
+        Even the current page is not created before it is needed
+        for the layout, so that we don't create pages, that are
+        replaced by a following setCurrentIndex()
+     */
+    if ( m_data->items.count() == 1 )
+        m_data->currentIndex = 0;
+    else if ( index <= m_data->currentIndex )
+        m_data->currentIndex++;
+
+    if ( oldCurrentIndex != m_data->currentIndex )
+        Q_EMIT currentIndexChanged( m_data->currentIndex );
+
+    polish();
+}
+
+bool QskStackBox::isLoaded( int index ) const
+{
+    return m_data->items.value( index ) != nullptr;
+}
+
+void QskStackBox::setPreloadDistance( int distance )
+{
+    distance = qMax( distance, 0 );
+
+    if ( distance != m_data->preloadDistance )
+    {
+        m_data->preloadDistance = distance;
+        updatePages();
+
+        Q_EMIT preloadDistanceChanged( distance );
+    }
+}
+
+int QskStackBox::preloadDistance() const
+{
+    return m_data->preloadDistance;
+}
+
+void QskStackBox::setUnloadDistance( int distance )
+{
+    distance = qMax( distance, -1 );
+
+    if ( distance != m_data->unloadDistance )
+    {
+        m_data->unloadDistance = distance;
+        updatePages();
+
+        Q_EMIT unloadDistanceChanged( distance );
+    }
+}
+
+int QskStackBox::unloadDistance() const
+{
+    return m_data->unloadDistance;
+}
+
+QQuickItem* QskStackBox::loadItem( int index )
+{
+    if ( index < 0 || index >= m_data->items.count() )
+        return nullptr;
+
+    if ( auto item = m_data->items[ index ] )
+        return item;
+
+    const auto page = m_data->pages[ index ];
+    if ( !page.factory )
+        return nullptr;
+
+    m_data->isLoading = true;
+    auto item = page.factory();
+    m_data->isLoading = false;
+
+    if ( item == nullptr )
+        return nullptr;
+
+    if ( page.alignment )
+    {
+        if ( auto control = qskControlCast( item ) )
+            control->setLayoutAlignmentHint( page.alignment );
+    }
+
+    reparentItem( item );
+
+    // the factory might have created the item with a different parent
+    item->setParent( this );
+
+    item->setVisible( index == m_data->currentIndex );
+    m_data->items[ index ] = item;
+
+    resetImplicitSize();
+    polish();
+
+    Q_EMIT pageLoaded( index, item );
+
+    return item;
+}
+
+void QskStackBox::unloadItem( int index )
+{
+    auto item = m_data->items.value( index );
+    if ( item == nullptr || !m_data->pages[ index ].factory )
+        return;
+
+    m_data->items[ index ] = nullptr;
+
+    unparentItem( item );
+    item->deleteLater();
+
+    resetImplicitSize();
+}
+
+void QskStackBox::updatePages()
+{
+    const int currentIndex = m_data->currentIndex;
+    if ( currentIndex < 0 )
+        return;
+
+    int startIndex = -1;
+    int endIndex = -1;
+
+    if ( const auto animator = m_data->animator.data() )
+    {
+        if ( animator->isRunning() && animator->transientIndex() != currentIndex )
+        {
+            // the pages of the running transition
+            startIndex = animator->startIndex();
+            endIndex = animator->endIndex();
+        }
+    }
+
+    const int count = m_data->items.count();
+
+    for ( int i = 0; i < count; i++ )
+    {
+        if ( !m_data->pages[i].factory )
+            continue;
+
+        const int distance = qskIndexDistance( i, currentIndex, count );
+
+        if ( distance <= m_data->preloadDistance )
+        {
+            loadItem( i );
+        }
+        else if ( m_data->unloadDistance >= 0 && distance > m_data->unloadDistance )
+        {
+            if ( i != startIndex && i != endIndex )
+                unloadItem( i );
+        }
+    }
+}
+
 void QskStackBox::removeAt( int index )
 {
     removeItemInternal( index, true );
@@ -277,10 +490,17 @@ void QskStackBox::removeItemInternal( int index, bool unparent )
     if ( unparent )
     {
         if ( auto item = m_data->items[ index ] )
+        {
             unparentItem( item );
+
+            // pages from a factory are owned by the box
+            if ( m_data->pages[ index ].factory )
+                item->deleteLater();
+        }
     }
 
     m_data->items.removeAt( index );
+    m_data->pages.removeAt( index );
 
     auto& currentIndex = m_data->currentIndex;
 
@@ -292,7 +512,10 @@ void QskStackBox::removeItemInternal( int index, bool unparent )
             currentIndex = 0;
 
         if ( currentIndex >= 0 )
-            m_data->items[ currentIndex ]->setVisible( true );
+        {
+            if ( auto item = loadItem( currentIndex ) )
+                item->setVisible( true );
+        }
 
         Q_EMIT currentIndexChanged( currentIndex );
     }
@@ -308,7 +531,8 @@ void QskStackBox::removeItem( const QQuickItem* item )
 
 void QskStackBox::autoAddItem( QQuickItem* item )
 {
-    removeAt( indexOf( item ) );
+    if ( !m_data->isLoading )
+        addItem( item );
 }
 
 void QskStackBox::autoRemoveItem( QQuickItem* item )
@@ -318,15 +542,22 @@ void QskStackBox::autoRemoveItem( QQuickItem* item )
 
 void QskStackBox::clear( bool autoDelete )
 {
-    for ( const auto item : std::as_const( m_data->items ) )
+    for ( int i = 0; i < m_data->items.count(); i++ )
     {
-        if( autoDelete && ( item->parent() == this ) )
+        const auto item = m_data->items[i];
+        if ( item == nullptr )
+            continue;
+
+        const bool isPage = bool( m_data->pages[i].factory );
+
+        if( ( autoDelete || isPage ) && ( item->parent() == this ) )
             delete item;
         else
             item->setParentItem( nullptr );
     }
 
     m_data->items.clear();
+    m_data->pages.clear();
 
     if ( m_data->currentIndex >= 0 )
     {
@@ -356,9 +587,13 @@ void QskStackBox::updateLayout()
     if ( maybeUnresized() )
         return;
 
+    updatePages();
+
     for ( int i = 0; i < m_data->items.count(); i++ )
     {
         auto item = m_data->items[ i ];
+        if ( item == nullptr )
+            continue;
 
         const auto visibility =
             ( i == m_data->currentIndex ) ? Qsk::Visible : Qsk::Hidden;
@@ -385,7 +620,11 @@ QSizeF QskStackBox::layoutSizeHint(
         /*
             We ignore the retainSizeWhenVisible flag and include all
             invisible items. Maybe we should offer a flag to control this ?
+            Pages, that have not been loaded yet, can't be included.
          */
+        if ( item == nullptr )
+            continue;
+
         const auto policy = qskSizePolicy( item );
 
         if ( constraint.width() >= 0.0 && policy.isConstrained( Qt::Vertical ) )
@@ -450,6 +689,12 @@ void QskStackBox::dump() const
 
         debug << "  " << i << ": ";
 
+        if ( item == nullptr )
+        {
+            debug << "[ not loaded ]\n";
+            continue;
+        }
+
         const auto size = qskSizeConstraint( item, Qt::PreferredSize );
         debug << item->metaObject()->className()
               << " w:" << size.width() << " h:" << size.height();
@@ -7,6 +7,7 @@
 #define QSK_STACK_BOX_H
 
 #include "QskIndexedLayoutBox.h"
+#include <functional>
 
 class QskStackBoxAnimator;
 
@@ -23,9 +24,17 @@ class QSK_EXPORT QskStackBox : public QskIndexedLayoutBox
     Q_PROPERTY( QQuickItem* currentItem READ currentItem
         WRITE setCurrentItem NOTIFY currentItemChanged )
 
+    Q_PROPERTY( int preloadDistance READ preloadDistance
+        WRITE setPreloadDistance NOTIFY preloadDistanceChanged )
+
+    Q_PROPERTY( int unloadDistance READ unloadDistance
+        WRITE setUnloadDistance NOTIFY unloadDistanceChanged )
+
     using Inherited = QskBox;
 
   public:
+    using PageFactory = std::function< QQuickItem*() >;
+
     explicit QskStackBox( QQuickItem* parent = nullptr );
     QskStackBox( bool autoAddChildren, QQuickItem* parent = nullptr );
 
@@ -43,6 +52,30 @@ class QSK_EXPORT QskStackBox : public QskIndexedLayoutBox
     void insertItem( int index, QQuickItem* );
     void insertItem( int index, QQuickItem*, Qt::Alignment );
 
+    /*
+        Pages, that are created by a factory, when being needed for the
+        first time. Until then itemAtIndex() returns a nullptr.
+        The box takes ownership of the created items.
+     */
+    void addPage( const PageFactory&, Qt::Alignment = Qt::Alignment() );
+    void insertPage( int index, const PageFactory&, Qt::Alignment = Qt::Alignment() );
+
+    bool isLoaded( int index ) const;
+
+    /*
+        Pages being closer to the current index, than the preload distance,
+        are created in advance, so that they are ready for transitions.
+        Pages being more distant, than the unload distance, are destroyed
+        and created again by the factory, when being needed.
+        The first and the last page count as being neighbours - like
+        in the transitions of the animators.
+     */
+    void setPreloadDistance( int );
+    int preloadDistance() const;
+
+    void setUnloadDistance( int ); // < 0: never unload
+    int unloadDistance() const;
+
     void removeItem( const QQuickItem* );
     void removeAt( int index );
 
@@ -64,6 +97,8 @@ class QSK_EXPORT QskStackBox : public QskIndexedLayoutBox
 
   Q_SIGNALS:
     void defaultAlignmentChanged( Qt::Alignment );
+    void preloadDistanceChanged( int );
+    void unloadDistanceChanged( int );
 
   public Q_SLOTS:
     void setCurrentIndex( int index );
@@ -75,6 +110,9 @@ class QSK_EXPORT QskStackBox : public QskIndexedLayoutBox
     void transientIndexChanged( qreal index );
     void currentItemChanged( QQuickItem* );
 
+    // a page has been created by its factory
+    void pageLoaded( int index, QQuickItem* );
+
   protected:
     bool event( QEvent* ) override;
     void updateLayout() override;
@@ -89,6 +127,10 @@ class QSK_EXPORT QskStackBox : public QskIndexedLayoutBox
 
     void removeItemInternal( int index, bool unparent );
 
+    QQuickItem* loadItem( int index );
+    void unloadItem( int index );
+    void updatePages();
+
     class PrivateData;
     std::unique_ptr< PrivateData > m_data;
 };
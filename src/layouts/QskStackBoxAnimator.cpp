@@ -305,7 +305,7 @@ bool QskStackBoxAnimator1::eventFilter( QObject* object, QEvent* event )
         {
             case QskEvent::GeometryChange:
             case QskEvent::ContentsRectChange:
-            case QskEvent::LayoutRequest:
+            case QEvent::LayoutRequest:
             {
                 m_isDirty = true;
                 break;
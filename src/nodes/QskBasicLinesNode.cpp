@@ -4,6 +4,8 @@
  *****************************************************************************/
 
 #include "QskBasicLinesNode.h"
+#include "QskStippleMetrics.h"
+#include "QskVertex.h"
 
 #include <qsgmaterial.h>
 #include <qsggeometry.h>
@@ -13,6 +15,9 @@ QSK_QT_PRIVATE_BEGIN
 #include <private/qsgnode_p.h>
 QSK_QT_PRIVATE_END
 
+// the maximum number of entries of a dash pattern, that can be done in the shader
+static const int qskMaxShaderStops = 8;
+
 static inline QVector4D qskColorVector( const QColor& c, qreal opacity)
 {
     const auto a = c.alphaF() * opacity;
@@ -28,6 +33,22 @@ static inline QVector2D qskOrigin(
     );
 }
 
+static const QSGGeometry::AttributeSet& qskDashAttributes()
+{
+    static const QSGGeometry::Attribute attributes[] =
+    {
+        QSGGeometry::Attribute::createWithAttributeType(
+            0, 2, QSGGeometry::FloatType, QSGGeometry::PositionAttribute ),
+        QSGGeometry::Attribute::createWithAttributeType(
+            1, 1, QSGGeometry::FloatType, QSGGeometry::UnknownAttribute )
+    };
+
+    static const QSGGeometry::AttributeSet attributeSet =
+        { 2, sizeof( QskVertex::DashPoint ), attributes };
+
+    return attributeSet;
+}
+
 #if QT_VERSION < QT_VERSION_CHECK( 6, 0, 0 )
     #include <QSGMaterialRhiShader>
     using RhiShader = QSGMaterialRhiShader;
@@ -40,7 +61,7 @@ namespace
     class Material final : public QSGMaterial
     {
       public:
-        Material();
+        Material( bool dashed );
 
 #if QT_VERSION < QT_VERSION_CHECK( 6, 0, 0 )
         QSGMaterialShader* createShader() const override;
@@ -52,20 +73,32 @@ namespace
 
         int compare( const QSGMaterial* other ) const override;
 
+        bool setDashPattern( const QskStippleMetrics& );
+        bool isDashPatternEqual( const Material* ) const;
+
+        const bool m_dashed;
+
         QColor m_color = QColor( 255, 255, 255 );
         Qt::Orientations m_pixelAlignment;
+
+        // dash pattern
+        float m_offset = 0.0f;
+        float m_patternLength = 0.0f;
+        QVector4D m_stops[ 2 ];
     };
 
     class ShaderRhi final : public RhiShader
     {
       public:
 
-        ShaderRhi()
+        ShaderRhi( bool dashed )
         {
             const QString root( ":/qskinny/shaders/" );
 
-            setShaderFileName( VertexStage, root + "crisplines.vert.qsb" );
-            setShaderFileName( FragmentStage, root + "crisplines.frag.qsb" );
+            const QString name = dashed ? "dashedlines" : "crisplines";
+
+            setShaderFileName( VertexStage, root + name + ".vert.qsb" );
+            setShaderFileName( FragmentStage, root + name + ".frag.qsb" );
         }
 
         bool updateUniformData( RenderState& state,
@@ -74,7 +107,7 @@ namespace
             auto matOld = static_cast< Material* >( oldMaterial );
             auto matNew = static_cast< Material* >( newMaterial );
 
-            Q_ASSERT( state.uniformData()->size() >= 88 );
+            Q_ASSERT( state.uniformData()->size() >= ( matNew->m_dashed ? 128 : 88 ) );
 
             auto data = state.uniformData()->data();
             bool changed = false;
@@ -112,6 +145,18 @@ namespace
                 changed = true;
             }
 
+            if ( matNew->m_dashed )
+            {
+                if ( ( matOld == nullptr ) || !matNew->isDashPatternEqual( matOld ) )
+                {
+                    memcpy( data + 88, &matNew->m_offset, 4 );
+                    memcpy( data + 92, &matNew->m_patternLength, 4 );
+                    memcpy( data + 96, matNew->m_stops, 32 );
+
+                    changed = true;
+                }
+            }
+
             return changed;
         }
     };
@@ -126,21 +171,35 @@ namespace
     class ShaderGL final : public QSGMaterialShader
     {
       public:
-        ShaderGL()
+        ShaderGL( bool dashed )
+            : m_dashed( dashed )
         {
             const QString root( ":/qskinny/shaders/" );
 
-            setShaderSourceFile( QOpenGLShader::Vertex,
-                ":/qskinny/shaders/crisplines.vert" );
+            if ( dashed )
+            {
+                setShaderSourceFile( QOpenGLShader::Vertex,
+                    ":/qskinny/shaders/dashedlines.vert" );
+
+                setShaderSourceFile( QOpenGLShader::Fragment,
+                    ":/qskinny/shaders/dashedlines.frag" );
+            }
+            else
+            {
+                setShaderSourceFile( QOpenGLShader::Vertex,
+                    ":/qskinny/shaders/crisplines.vert" );
 
-            setShaderSourceFile( QOpenGLShader::Fragment,
-                ":/qt-project.org/scenegraph/shaders/flatcolor.frag" );
+                setShaderSourceFile( QOpenGLShader::Fragment,
+                    ":/qt-project.org/scenegraph/shaders/flatcolor.frag" );
+            }
         }
 
         char const* const* attributeNames() const override
         {
             static char const* const names[] = { "in_vertex", nullptr };
-            return names;
+            static char const* const dashNames[] = { "in_vertex", "in_distance", nullptr };
+
+            return m_dashed ? dashNames : names;
         }
 
         void initialize() override
@@ -152,6 +211,13 @@ namespace
             m_matrixId = p->uniformLocation( "matrix" );
             m_colorId = p->uniformLocation( "color" );
             m_originId = p->uniformLocation( "origin" );
+
+            if ( m_dashed )
+            {
+                m_offsetId = p->uniformLocation( "offset" );
+                m_patternLengthId = p->uniformLocation( "patternLength" );
+                m_stopsId = p->uniformLocation( "stops" );
+            }
         }
 
         void updateState( const QSGMaterialShader::RenderState& state,
@@ -179,19 +245,33 @@ namespace
                 const auto origin = qskOrigin(
                     state.viewportRect(), material->m_pixelAlignment );;
                 p->setUniformValue( m_originId, origin );
+
+                if ( m_dashed )
+                {
+                    p->setUniformValue( m_offsetId, material->m_offset );
+                    p->setUniformValue( m_patternLengthId, material->m_patternLength );
+                    p->setUniformValueArray( m_stopsId, material->m_stops, 2 );
+                }
             }
         }
 
       private:
+        const bool m_dashed;
+
         int m_matrixId = -1;
         int m_colorId = -1;
         int m_originId = -1;
+
+        int m_offsetId = -1;
+        int m_patternLengthId = -1;
+        int m_stopsId = -1;
     };
 }
 
 #endif
 
-Material::Material()
+Material::Material( bool dashed )
+    : m_dashed( dashed )
 {
 #if QT_VERSION < QT_VERSION_CHECK( 6, 0, 0 )
     setFlag( QSGMaterial::SupportsRhiShader, true );
@@ -203,16 +283,16 @@ Material::Material()
 QSGMaterialShader* Material::createShader() const
 {
     if ( !( flags() & QSGMaterial::RhiShaderWanted ) )
-        return new ShaderGL();
+        return new ShaderGL( m_dashed );
 
-    return new ShaderRhi();
+    return new ShaderRhi( m_dashed );
 }
 
 #else
 
 QSGMaterialShader* Material::createShader( QSGRendererInterface::RenderMode ) const
 {
-    return new ShaderRhi();
+    return new ShaderRhi( m_dashed );
 }
 
 #endif
@@ -220,7 +300,9 @@ QSGMaterialShader* Material::createShader( QSGRendererInterface::RenderMode ) co
 QSGMaterialType* Material::type() const
 {
     static QSGMaterialType staticType;
-    return &staticType;
+    static QSGMaterialType staticDashType;
+
+    return m_dashed ? &staticDashType : &staticType;
 }
 
 int Material::compare( const QSGMaterial* other ) const
@@ -228,7 +310,8 @@ int Material::compare( const QSGMaterial* other ) const
     auto material = static_cast< const Material* >( other );
 
     if ( ( material->m_color == m_color )
-        && ( material->m_pixelAlignment == m_pixelAlignment ) )
+        && ( material->m_pixelAlignment == m_pixelAlignment )
+        && isDashPatternEqual( material ) )
     {
         return 0;
     }
@@ -236,17 +319,70 @@ int Material::compare( const QSGMaterial* other ) const
     return QSGMaterial::compare( other );
 }
 
+bool Material::setDashPattern( const QskStippleMetrics& metrics )
+{
+    const auto pattern = metrics.pattern();
+
+    float stops[ qskMaxShaderStops ];
+
+    float length = 0.0f;
+    for ( int i = 0; i < pattern.count(); i++ )
+    {
+        length += pattern[i];
+        stops[i] = length;
+    }
+
+    // unused stops are never passed
+    for ( int i = pattern.count(); i < qskMaxShaderStops; i++ )
+        stops[i] = length;
+
+    const QVector4D s0( stops[0], stops[1], stops[2], stops[3] );
+    const QVector4D s1( stops[4], stops[5], stops[6], stops[7] );
+
+    const float offset = metrics.offset();
+
+    if ( offset == m_offset && length == m_patternLength
+        && s0 == m_stops[0] && s1 == m_stops[1] )
+    {
+        return false;
+    }
+
+    m_offset = offset;
+    m_patternLength = length;
+    m_stops[0] = s0;
+    m_stops[1] = s1;
+
+    return true;
+}
+
+bool Material::isDashPatternEqual( const Material* other ) const
+{
+    return ( m_offset == other->m_offset )
+        && ( m_patternLength == other->m_patternLength )
+        && ( m_stops[0] == other->m_stops[0] )
+        && ( m_stops[1] == other->m_stops[1] );
+}
+
 class QskBasicLinesNodePrivate final : public QSGGeometryNodePrivate
 {
   public:
     QskBasicLinesNodePrivate()
         : geometry( QSGGeometry::defaultAttributes_Point2D(), 0 )
+        , dashGeometry( qskDashAttributes(), 0 )
+        , material( false )
+        , dashMaterial( true )
     {
         geometry.setDrawingMode( QSGGeometry::DrawLines );
+        dashGeometry.setDrawingMode( QSGGeometry::DrawLines );
     }
 
     QSGGeometry geometry;
+    QSGGeometry dashGeometry;
+
     Material material;
+    Material dashMaterial;
+
+    QskStippleMetrics stippleMetrics;
 };
 
 QskBasicLinesNode::QskBasicLinesNode()
@@ -269,6 +405,8 @@ void QskBasicLinesNode::setPixelAlignment( Qt::Orientations orientations )
     if ( orientations != d->material.m_pixelAlignment )
     {
         d->material.m_pixelAlignment = orientations;
+        d->dashMaterial.m_pixelAlignment = orientations;
+
         markDirty( QSGNode::DirtyMaterial );
     }
 }
@@ -286,6 +424,8 @@ void QskBasicLinesNode::setColor( const QColor& color )
     if ( c != d->material.m_color )
     {
         d->material.m_color = c;
+        d->dashMaterial.m_color = c;
+
         markDirty( QSGNode::DirtyMaterial );
     }
 }
@@ -301,7 +441,10 @@ void QskBasicLinesNode::setLineWidth( float lineWidth )
 
     lineWidth = std::max( lineWidth, 0.0f );
     if( lineWidth != d->geometry.lineWidth() )
+    {
         d->geometry.setLineWidth( lineWidth );
+        d->dashGeometry.setLineWidth( lineWidth );
+    }
 }
 
 float QskBasicLinesNode::lineWidth() const
@@ -309,3 +452,62 @@ float QskBasicLinesNode::lineWidth() const
     return d_func()->geometry.lineWidth();
 }
 
+bool QskBasicLinesNode::isShaderStipple( const QskStippleMetrics& metrics )
+{
+    if ( !metrics.isValid() || metrics.isSolid() )
+        return false;
+
+    const auto pattern = metrics.pattern();
+
+    // odd patterns would need to be repeated
+    if ( ( pattern.count() % 2 ) || ( pattern.count() > qskMaxShaderStops ) )
+        return false;
+
+    qreal length = 0.0;
+    for ( const auto value : pattern )
+    {
+        if ( value < 0.0 )
+            return false;
+
+        length += value;
+    }
+
+    return length > 0.0;
+}
+
+void QskBasicLinesNode::setStippleMetrics( const QskStippleMetrics& metrics )
+{
+    Q_D( QskBasicLinesNode );
+
+    d->stippleMetrics = metrics;
+
+    if ( isShaderStipple( metrics ) )
+    {
+        if ( d->dashMaterial.setDashPattern( metrics ) )
+            markDirty( QSGNode::DirtyMaterial );
+
+        if ( geometry() != &d->dashGeometry )
+        {
+            setGeometry( &d->dashGeometry );
+            setMaterial( &d->dashMaterial );
+        }
+    }
+    else
+    {
+        if ( geometry() != &d->geometry )
+        {
+            setGeometry( &d->geometry );
+            setMaterial( &d->material );
+        }
+    }
+}
+
+QskStippleMetrics QskBasicLinesNode::stippleMetrics() const
+{
+    return d_func()->stippleMetrics;
+}
+
+bool QskBasicLinesNode::isStippledByShader() const
+{
+    return geometry() == &d_func()->dashGeometry;
+}
@@ -12,6 +12,7 @@
 #include <qnamespace.h>
 
 class QColor;
+class QskStippleMetrics;
 
 class QskBasicLinesNodePrivate;
 
@@ -36,6 +37,20 @@ class QSK_EXPORT QskBasicLinesNode : public QSGGeometryNode
     void setLineWidth( float );
     float lineWidth() const;
 
+    /*
+        Dash patterns with up to 8 entries can be evaluated in the fragment shader.
+        Then the geometry is made of QskVertex::DashPoint and each line
+        needs 2 vertices only - regardless of the number of dashes.
+        Otherwise the geometry is made of QSGGeometry::Point2D and the
+        dashes have to be split into lines on the CPU.
+     */
+    static bool isShaderStipple( const QskStippleMetrics& );
+
+    void setStippleMetrics( const QskStippleMetrics& );
+    QskStippleMetrics stippleMetrics() const;
+
+    bool isStippledByShader() const;
+
   private:
     Q_DECLARE_PRIVATE( QskBasicLinesNode )
 };
@@ -0,0 +1,325 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) 2016 Uwe Rathmann
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#include "QskLayerNode.h"
+#include "QskSceneTexture.h"
+#include "QskTreeNode.h"
+
+#include <qquickitem.h>
+#include <qquickwindow.h>
+#include <qsgimagenode.h>
+
+#include <atomic>
+
+QSK_QT_PRIVATE_BEGIN
+#include <private/qquickitem_p.h>
+QSK_QT_PRIVATE_END
+
+namespace
+{
+    std::atomic< int > qskLayerCount( 0 );
+    std::atomic< quint64 > qskRenderCount( 0 );
+    std::atomic< qint64 > qskTextureMemory( 0 );
+}
+
+/*
+    The paint node and the item nodes of the child items
+    are siblings below the same container node
+ */
+
+static inline bool qskCanBlockSiblings( const QSGNode* node )
+{
+    if ( auto parentNode = node->parent() )
+    {
+        for ( auto sibling = parentNode->firstChild();
+            sibling != nullptr; sibling = sibling->nextSibling() )
+        {
+            if ( sibling != node && !qskIsBlockableNode( sibling ) )
+                return false;
+        }
+    }
+
+    return true;
+}
+
+static inline bool qskBlockSiblings( QSGNode* node, bool on, bool notify )
+{
+    bool changed = false;
+
+    if ( auto parentNode = node->parent() )
+    {
+        for ( auto sibling = parentNode->firstChild();
+            sibling != nullptr; sibling = sibling->nextSibling() )
+        {
+            if ( sibling != node && sibling->isSubtreeBlocked() != on )
+            {
+                if ( qskTryBlockNode( sibling, on, notify ) )
+                    changed = true;
+            }
+        }
+    }
+
+    return changed;
+}
+
+class QskLayerNode::PrivateData
+{
+  public:
+    ~PrivateData()
+    {
+        setTextureMemory( 0 );
+        delete texture;
+    }
+
+    void setTextureMemory( qint64 bytes )
+    {
+        qskTextureMemory += bytes - textureMemory;
+        textureMemory = bytes;
+    }
+
+    const QQuickWindow* window = nullptr;
+    QSGRootNode* rootNode = nullptr;
+
+    QskTreeNode* contentRoot = nullptr;
+    QskTreeNode* textureRoot = nullptr;
+
+    QSGImageNode* imageNode = nullptr;
+    QskSceneTexture* texture = nullptr;
+
+    QRectF rect;
+
+    quint64 renderCount = 0;
+    qint64 textureMemory = 0;
+
+    bool isCached = false;
+    bool isRendering = false;
+    bool isRectDirty = true;
+};
+
+QskLayerNode::QskLayerNode()
+    : m_data( new PrivateData() )
+{
+    setFlag( QSGNode::UsePreprocess, true );
+
+    m_data->contentRoot = new QskTreeNode();
+    m_data->textureRoot = new QskTreeNode();
+
+    // hidden until we have a texture
+    m_data->textureRoot->setSubtreeBlocked( true, false );
+
+    appendChildNode( m_data->contentRoot );
+    appendChildNode( m_data->textureRoot );
+
+    qskLayerCount++;
+}
+
+QskLayerNode::~QskLayerNode()
+{
+    qskLayerCount--;
+}
+
+void QskLayerNode::setContentNode( QSGNode* node )
+{
+    auto contentRoot = m_data->contentRoot;
+
+    auto oldNode = contentRoot->firstChild();
+    if ( node == oldNode )
+        return;
+
+    // like QQuickWindow: deleting the previous node is up to the item
+    if ( oldNode )
+        contentRoot->removeChildNode( oldNode );
+
+    if ( node )
+        contentRoot->appendChildNode( node );
+}
+
+QSGNode* QskLayerNode::contentNode() const
+{
+    return m_data->contentRoot->firstChild();
+}
+
+void QskLayerNode::updateNode( const QQuickItem* item )
+{
+    // called from updatePaintNode, while the GUI thread is blocked
+
+    m_data->window = item->window();
+    m_data->rootNode = QQuickItemPrivate::get( item )->rootNode();
+
+    const QRectF rect( 0.0, 0.0, item->width(), item->height() );
+    if ( rect != m_data->rect )
+    {
+        m_data->rect = rect;
+        m_data->isRectDirty = true;
+    }
+
+    if ( m_data->imageNode == nullptr && m_data->window )
+    {
+        auto imageNode = m_data->window->createImageNode();
+        imageNode->setOwnsTexture( false );
+
+        m_data->textureRoot->appendChildNode( imageNode );
+        m_data->imageNode = imageNode;
+    }
+}
+
+void QskLayerNode::preprocess()
+{
+    if ( m_data->isRendering )
+    {
+        // called from the renderer of our texture
+        return;
+    }
+
+    const bool cachable = ( m_data->rootNode != nullptr )
+        && ( m_data->imageNode != nullptr )
+        && !m_data->rect.isEmpty() && qskCanBlockSiblings( this );
+
+    setCached( cachable );
+
+    if ( !cachable )
+        return;
+
+    if ( qskBlockSiblings( this, true, true ) )
+    {
+        /*
+            Blocking item nodes, that have been added since the last
+            frame, has also been reported to the renderer of the texture.
+            As it has dropped them from its internal tree we need to
+            start over with a new one.
+         */
+        delete m_data->texture;
+        m_data->texture = nullptr;
+    }
+
+    if ( m_data->texture == nullptr || m_data->isRectDirty
+        || m_data->texture->isDirty() )
+    {
+        renderTexture();
+    }
+}
+
+void QskLayerNode::setCached( bool on )
+{
+    if ( on == m_data->isCached )
+        return;
+
+    m_data->isCached = on;
+
+    /*
+        What is seen by the renderer of the window. The renderer of the texture
+        is also notified and has to be recreated, as it needs to see the
+        opposite state.
+     */
+    m_data->contentRoot->setSubtreeBlocked( on, true );
+    m_data->textureRoot->setSubtreeBlocked( !on, true );
+    qskBlockSiblings( this, on, true );
+
+    delete m_data->texture;
+    m_data->texture = nullptr;
+
+    m_data->setTextureMemory( 0 );
+}
+
+void QskLayerNode::setRendering( bool on )
+{
+    /*
+        Toggling between what has to be seen by the renderer of the
+        window and the renderer of the texture without notifications.
+        This is the same trick as in QskSceneTexture for the trailing nodes.
+     */
+    m_data->isRendering = on;
+
+    m_data->contentRoot->setSubtreeBlocked( !on, false );
+    m_data->textureRoot->setSubtreeBlocked( on, false );
+    qskBlockSiblings( this, !on, false );
+}
+
+void QskLayerNode::renderTexture()
+{
+    auto imageNode = m_data->imageNode;
+
+    if ( m_data->texture == nullptr )
+    {
+        m_data->texture = new QskSceneTexture( m_data->window );
+
+        // the material updates of the image node must not trigger a new render cycle
+        m_data->texture->setTextureNode( imageNode );
+    }
+
+    /*
+        The modifications of the image node are reported to the
+        renderer of the texture, so they have to be done before rendering
+     */
+    if ( imageNode->texture() != m_data->texture )
+        imageNode->setTexture( m_data->texture );
+
+    if ( imageNode->rect() != m_data->rect )
+        imageNode->setRect( m_data->rect );
+
+    setRendering( true );
+    const bool rendered = m_data->texture->render(
+        m_data->rootNode, nullptr, m_data->rect );
+    setRendering( false );
+
+    m_data->isRectDirty = false;
+
+    if ( !rendered )
+        return;
+
+    imageNode->markDirty( QSGNode::DirtyMaterial );
+
+    m_data->renderCount++;
+    qskRenderCount++;
+
+    const auto size = m_data->texture->textureSize();
+    m_data->setTextureMemory( qint64( size.width() ) * size.height() * 4 );
+}
+
+bool QskLayerNode::isCached() const
+{
+    return m_data->isCached;
+}
+
+quint64 QskLayerNode::renderCount() const
+{
+    return m_data->renderCount;
+}
+
+qint64 QskLayerNode::textureMemory() const
+{
+    return m_data->textureMemory;
+}
+
+QskLayerNode::Statistics QskLayerNode::statistics()
+{
+    Statistics statistics;
+
+    statistics.layerCount = qskLayerCount;
+    statistics.renderCount = qskRenderCount;
+    statistics.textureMemory = qskTextureMemory;
+
+    return statistics;
+}
+
+#ifndef QT_NO_DEBUG_STREAM
+
+#include <qdebug.h>
+
+QDebug operator<<( QDebug debug, const QskLayerNode::Statistics& statistics )
+{
+    QDebugStateSaver saver( debug );
+    debug.nospace();
+
+    debug << "Layers" << "( ";
+    debug << statistics.layerCount << ", ";
+    debug << "Renderings: " << statistics.renderCount << ", ";
+    debug << "Memory: " << statistics.textureMemory / 1024 << "kB";
+    debug << " )";
+
+    return debug;
+}
+
+#endif
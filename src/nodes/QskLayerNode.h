@@ -0,0 +1,73 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) 2016 Uwe Rathmann
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#ifndef QSK_LAYER_NODE_H
+#define QSK_LAYER_NODE_H
+
+#include "QskGlobal.h"
+#include <qsgnode.h>
+#include <memory>
+
+class QQuickItem;
+
+/*
+    Paint node of items with the QskQuickItem::CacheAsTexture flag.
+
+    The subtree of the item - its own nodes and the nodes of its child items -
+    is rendered into a QskSceneTexture, that is displayed by a single image node.
+    The texture is only rendered again when nodes inside the subtree have been
+    changed. The main renderer does not see the cached subtree at all.
+
+    As blocking the subtree from the main renderer is implemented using
+    QskItemNode, caching is only possible, when all child items are QskQuickItems.
+    Otherwise the subtree is rendered the usual way.
+ */
+class QSK_EXPORT QskLayerNode final : public QSGNode
+{
+  public:
+    class Statistics
+    {
+      public:
+        int layerCount = 0;
+        quint64 renderCount = 0;
+        qint64 textureMemory = 0; // in bytes
+    };
+
+    QskLayerNode();
+    ~QskLayerNode() override;
+
+    // the paint node of the item
+    void setContentNode( QSGNode* );
+    QSGNode* contentNode() const;
+
+    void updateNode( const QQuickItem* );
+
+    void preprocess() override;
+
+    bool isCached() const;
+
+    quint64 renderCount() const;
+    qint64 textureMemory() const;
+
+    // accumulated values of all layers
+    static Statistics statistics();
+
+  private:
+    void setCached( bool );
+    void setRendering( bool );
+    void renderTexture();
+
+    class PrivateData;
+    std::unique_ptr< PrivateData > m_data;
+};
+
+#ifndef QT_NO_DEBUG_STREAM
+
+class QDebug;
+QSK_EXPORT QDebug operator<<( QDebug, const QskLayerNode::Statistics& );
+
+#endif
+
+#endif
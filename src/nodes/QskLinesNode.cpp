@@ -79,6 +79,52 @@ static QSGGeometry::Point2D* qskAddDashes( const QTransform& transform,
     return points;
 }
 
+static QskVertex::DashLine* qskAddDashLines( const QTransform& transform,
+    int count, const QLineF* lines, QskVertex::DashLine* dashLines )
+{
+    const bool doTransform = !transform.isIdentity();
+
+    for ( int i = 0; i < count; i++ )
+    {
+        auto p1 = lines[i].p1();
+        auto p2 = lines[i].p2();
+
+        if ( doTransform )
+        {
+            p1 = transform.map( p1 );
+            p2 = transform.map( p2 );
+        }
+
+        dashLines++->setLine( p1.x(), p1.y(), p2.x(), p2.y() );
+    }
+
+    return dashLines;
+}
+
+template< class Line >
+static Line* qskSetLines( Qt::Orientation orientation, qreal v1, qreal v2,
+    const QTransform& transform, int count, const qreal* values, Line* lines )
+{
+    if ( orientation == Qt::Vertical )
+    {
+        for ( int i = 0; i < count; i++ )
+        {
+            const auto x = mapX( transform, values[i] );
+            lines++->setVLine( x, v1, v2 );
+        }
+    }
+    else
+    {
+        for ( int i = 0; i < count; i++ )
+        {
+            const auto y = mapY( transform, values[i] );
+            lines++->setHLine( v1, v2, y );
+        }
+    }
+
+    return lines;
+}
+
 static QSGGeometry::Point2D* qskAddLines( const QTransform& transform,
     int count, const QLineF* lines, QSGGeometry::Point2D* points )
 {
@@ -170,6 +216,8 @@ void QskLinesNode::updateLines( const QColor& color,
         return;
     }
 
+    setStippleMetrics( stippleMetrics );
+
     QskHashValue hash = 9784;
 
     hash = stippleMetrics.hash( hash );
@@ -201,6 +249,8 @@ void QskLinesNode::updateGrid( const QColor& color,
         return;
     }
 
+    setStippleMetrics( stippleMetrics );
+
     QskHashValue hash = 9784;
 
     hash = stippleMetrics.hash( hash );
@@ -228,6 +278,15 @@ void QskLinesNode::updateGeometry( const QskStippleMetrics& stippleMetrics,
 {
     auto& geom = *geometry();
 
+    if ( isStippledByShader() )
+    {
+        // the dashes are done in the fragment shader
+        auto dashLines = QskVertex::allocateLines< QskVertex::DashLine >( geom, count );
+        qskAddDashLines( transform, count, lines, dashLines );
+
+        return;
+    }
+
     QSGGeometry::Point2D* points = nullptr;
 
     if ( stippleMetrics.isSolid() )
@@ -282,6 +341,22 @@ void QskLinesNode::updateGeometry(
     const auto x1 = mapX( transform, rect.left() );
     const auto x2 = mapX( transform, rect.right() );
 
+    if ( isStippledByShader() )
+    {
+        // the dashes are done in the fragment shader
+
+        auto lines = QskVertex::allocateLines< QskVertex::DashLine >(
+            geom, xValues.count() + yValues.count() );
+
+        lines = qskSetLines( Qt::Vertical, y1, y2,
+            transform, xValues.count(), xValues.constData(), lines );
+
+        qskSetLines( Qt::Horizontal, x1, x2,
+            transform, yValues.count(), yValues.constData(), lines );
+
+        return;
+    }
+
     QSGGeometry::Point2D* points = nullptr;
 
     if ( stippleMetrics.isSolid() )
@@ -386,22 +461,7 @@ QSGGeometry::Point2D* QskLinesNode::setSolidLines(
 
     auto lines = reinterpret_cast< QskVertex::Line* >( points );
 
-    if ( orientation == Qt::Vertical )
-    {
-        for ( int i = 0; i < count; i++ )
-        {
-            const auto x = mapX( transform, values[i] );
-            lines++->setVLine( x, v1, v2 );
-        }
-    }
-    else
-    {
-        for ( int i = 0; i < count; i++ )
-        {
-            const auto y = mapY( transform, values[i] );
-            lines++->setHLine( v1, v2, y );
-        }
-    }
+    lines = qskSetLines( orientation, v1, v2, transform, count, values, lines );
 
     return reinterpret_cast< QSGGeometry::Point2D* >( lines );
 }
@@ -415,6 +475,8 @@ void QskLinesNode::updatePolygon( const QColor& color, qreal lineWidth,
         return;
     }
 
+    setStippleMetrics( QskStippleMetrics() );
+
     if ( true ) // for the moment we always update the geometry. TODO ...
     {
         geometry()->allocate( polygon.count() + 1 );
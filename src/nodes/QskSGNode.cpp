@@ -4,9 +4,35 @@
  *****************************************************************************/
 
 #include "QskSGNode.h"
+#include "QskTreeNode.h"
+
+static inline QskTreeNode* qskIndexedNode( QSGNode* parent, quint8 role )
+{
+    return QskTreeNode::isIndexedRole( role ) ? qskTreeNodeCast( parent ) : nullptr;
+}
+
+static inline void qskUnindexChildNode( QSGNode* parent, QSGNode* child )
+{
+    const auto role = QskSGNode::nodeRole( child );
+
+    if ( auto treeNode = qskIndexedNode( parent, role ) )
+    {
+        if ( treeNode->roleNode( role ) == child )
+            treeNode->setRoleNode( role, nullptr );
+    }
+}
+
+static inline void qskIndexChildNode( QSGNode* parent, QSGNode* child )
+{
+    const auto role = QskSGNode::nodeRole( child );
+
+    if ( auto treeNode = qskIndexedNode( parent, role ) )
+        treeNode->setRoleNode( role, child );
+}
 
 static inline void qskRemoveChildNode( QSGNode* parent, QSGNode* child )
 {
+    qskUnindexChildNode( parent, child );
     parent->removeChildNode( child );
 
     if ( child->flags() & QSGNode::OwnedByParent )
@@ -25,43 +51,37 @@ static inline void qskRemoveAllChildNodesAfter( QSGNode* parent, QSGNode* child
     }
 }
 
-static void qskInsertChildSorted( QSGNode* parent, QSGNode* child,
-    const QVector< quint8 >& roles )
+static QSGNode* qskPrecedingSibling( const QSGNode* parent,
+    quint8 role, const QVector< quint8 >& roles )
 {
-    QSGNode* sibling = nullptr;
+    using namespace QskSGNode;
+
+    const int nodePos = roles.indexOf( role );
 
-    if ( parent->childCount() > 0 )
+    // in most cases we are appending, so let's start at the end
+
+    for ( auto childNode = parent->lastChild();
+        childNode != nullptr; childNode = childNode->previousSibling() )
     {
-        using namespace QskSGNode;
+        const auto childNodeRole = nodeRole( childNode );
+        if ( childNodeRole == BackgroundRole )
+            return childNode;
 
-        const int nodePos = roles.indexOf( nodeRole( child ) );
+        const int index = roles.indexOf( childNodeRole );
+        if ( index >= 0 && index < nodePos )
+            return childNode;
+    }
 
-        // in most cases we are appending, so let's start at the end
+    return nullptr;
+}
 
-        for ( auto childNode = parent->lastChild();
-            childNode != nullptr; childNode = childNode->previousSibling() )
-        {
-            const auto childNodeRole = nodeRole( childNode );
-            if ( childNodeRole == BackgroundRole )
-            {
-                sibling = childNode;
-            }
-            else
-            {
-                /*
-                   Imperformant implementation, but as the number of roles is
-                   usually < 5 we don't introduce some sort of support for faster lookups
-                 */
-
-                const int index = roles.indexOf( nodeRole( childNode ) );
-                if ( index >= 0 && index < nodePos )
-                    sibling = childNode;
-            }
+static void qskInsertChildSorted( QSGNode* parent, QSGNode* child,
+    const QVector< quint8 >& roles )
+{
+    QSGNode* sibling = nullptr;
 
-            if ( sibling != nullptr )
-                break;
-        }
-    }
+    if ( parent->firstChild() )
+        sibling = qskPrecedingSibling( parent, QskSGNode::nodeRole( child ), roles );
 
     if ( sibling )
         parent->insertChildNodeAfter( child, sibling );
@@ -78,21 +98,52 @@ void QskSGNode::setParentNode( QSGNode* node, QSGNode* parent )
         if ( oldParent != parent )
         {
             if ( oldParent )
+            {
+                qskUnindexChildNode( oldParent, node );
                 oldParent->removeChildNode( node );
+            }
 
             if ( parent )
+            {
                 parent->appendChildNode( node );
+                qskIndexChildNode( parent, node );
+            }
         }
     }
 }
 
 QSGNode* QskSGNode::findChildNode( QSGNode* parent, quint8 role )
 {
+    auto treeNode = qskIndexedNode( parent, role );
+
+    if ( treeNode )
+    {
+        if ( auto node = treeNode->roleNode( role ) )
+        {
+            if ( node->parent() == parent && nodeRole( node ) == role )
+                return node;
+
+            // removed by QSGNode::removeChildNode
+            treeNode->setRoleNode( role, nullptr );
+        }
+    }
+
+    /*
+        Nodes, that have been inserted by the QSGNode API, are
+        not in the index. So we also have to do the lookup for
+        unindexed roles.
+     */
+
     auto node = parent->firstChild();
     while ( node )
     {
         if ( nodeRole( node ) == role )
+        {
+            if ( treeNode )
+                treeNode->setRoleNode( role, node );
+
             return node;
+        }
 
         node = node->nextSibling();
     }
@@ -160,11 +211,10 @@ void QskSGNode::replaceChildNode(
     }
 
     if ( oldNode && oldNode != newNode )
-    {
-        parentNode->removeChildNode( oldNode );
-        if ( oldNode->flags() & QSGNode::OwnedByParent )
-            delete oldNode;
-    }
+        qskRemoveChildNode( parentNode, oldNode );
+
+    if ( newNode )
+        qskIndexChildNode( parentNode, newNode );
 }
 
 void QskSGNode::resetGeometry( QSGGeometryNode* node )
@@ -42,6 +42,7 @@ namespace QskSGNode
             node->setFlags( node->flags() | nodeRoleFlags( role ) );
     }
 
+    // usually O(1) for parents being a QskTreeNode, linear otherwise
     QSK_EXPORT QSGNode* findChildNode( QSGNode* parent, quint8 role );
     QSK_EXPORT bool removeChildNode( QSGNode* parent, quint8 role );
 
@@ -59,6 +59,9 @@ namespace
         inline bool isDirty() const { return m_dirty; }
 
         void setFinalNode( QSGTransformNode* );
+        inline QSGTransformNode* finalNode() const { return m_finalNode; }
+
+        void setMipmapped( bool );
 
         void setProjection( const QRectF& );
         void setTextureSize( const QSize& );
@@ -70,6 +73,7 @@ namespace
       private:
         void createTarget( const QSize& );
         void clearTarget();
+        void generateMipmaps();
 
         QSGTransformNode* m_finalNode = nullptr;
         QskSceneTexture* m_texture = nullptr;
@@ -89,6 +93,7 @@ namespace
         QRhiTexture* m_rhiTexture = nullptr;
 
         bool m_dirty = true;
+        bool m_mipmapped = false;
     };
 
     Renderer::Renderer( QskSceneTexture* texture, QSGDefaultRenderContext* context )
@@ -115,6 +120,16 @@ namespace
         }
     }
 
+    void Renderer::setMipmapped( bool on )
+    {
+        if ( on != m_mipmapped )
+        {
+            // the flags of the target texture are different
+            clearTarget();
+            m_mipmapped = on;
+        }
+    }
+
     void Renderer::setProjection( const QRectF& rect )
     {
         bool flipFramebuffer = true;
@@ -173,7 +188,8 @@ namespace
     {
         m_dirty = false;
 
-        qskTryBlockTrailingNodes( m_finalNode, rootNode(), true, false );
+        if ( m_finalNode )
+            qskTryBlockTrailingNodes( m_finalNode, rootNode(), true, false );
 
 #if 0
         static int counter = 0;
@@ -181,7 +197,12 @@ namespace
         QSGNodeDumper::dump( rootNode() );
 #endif
         Inherited::render();
-        qskTryBlockTrailingNodes( m_finalNode, rootNode(), false, false );
+
+        if ( m_finalNode )
+            qskTryBlockTrailingNodes( m_finalNode, rootNode(), false, false );
+
+        if ( m_mipmapped )
+            generateMipmaps();
     }
 
     void Renderer::nodeChanged( QSGNode* node, QSGNode::DirtyState state )
@@ -207,6 +228,8 @@ namespace
         if ( const auto rhi = context()->rhi() )
         {
             auto flags = QRhiTexture::RenderTarget | QRhiTexture::UsedAsTransferSource;
+            if ( m_mipmapped )
+                flags |= QRhiTexture::MipMapped | QRhiTexture::UsedWithGenerateMips;
 
             m_rhiTexture = rhi->newTexture( QRhiTexture::RGBA8, size, 1, flags );
 #if QT_VERSION < QT_VERSION_CHECK( 6, 0, 0 )
@@ -245,6 +268,7 @@ namespace
             QOpenGLFramebufferObjectFormat format;
             format.setInternalTextureFormat( GL_RGBA8 );
             format.setSamples( 0 );
+            format.setMipmap( m_mipmapped );
             format.setAttachment( QOpenGLFramebufferObject::CombinedDepthStencil );
 
             m_fbo = new QOpenGLFramebufferObject( size, format );
@@ -252,6 +276,33 @@ namespace
         }
     }
 
+    void Renderer::generateMipmaps()
+    {
+        if ( const auto rhi = context()->rhi() )
+        {
+            if ( m_rhiTexture && m_rt.cb )
+            {
+                auto batch = rhi->nextResourceUpdateBatch();
+                batch->generateMips( m_rhiTexture );
+
+                m_rt.cb->resourceUpdate( batch );
+            }
+        }
+        else
+        {
+#if QT_VERSION < QT_VERSION_CHECK( 6, 0, 0 )
+            if ( m_fbo )
+            {
+                auto funcs = QOpenGLContext::currentContext()->functions();
+
+                funcs->glBindTexture( GL_TEXTURE_2D, m_fbo->texture() );
+                funcs->glGenerateMipmap( GL_TEXTURE_2D );
+                funcs->glBindTexture( GL_TEXTURE_2D, 0 );
+            }
+#endif
+        }
+    }
+
     void Renderer::clearTarget()
     {
         if ( const auto rhi = context()->rhi() )
@@ -303,6 +354,12 @@ class QskSceneTexturePrivate final : public QSGTexturePrivate
 
     QRectF rect;
     const qreal devicePixelRatio;
+    qreal renderScale = 1.0;
+
+    bool mipmapped = false;
+
+    // a modified configuration requires rendering, even when the nodes are unchanged
+    bool isConfigDirty = false;
 
     Renderer* renderer = nullptr;
     QSGDefaultRenderContext* context = nullptr;
@@ -331,11 +388,42 @@ const QSGGeometryNode* QskSceneTexture::textureNode() const
     return d_func()->textureNode;
 }
 
+void QskSceneTexture::setRenderScale( qreal scale )
+{
+    Q_D( QskSceneTexture );
+
+    // upscaling makes no sense
+    scale = qBound( 0.01, scale, 1.0 );
+
+    if ( scale != d->renderScale )
+    {
+        d->renderScale = scale;
+        d->isConfigDirty = true;
+    }
+}
+
+qreal QskSceneTexture::renderScale() const
+{
+    return d_func()->renderScale;
+}
+
+void QskSceneTexture::setMipmapped( bool on )
+{
+    Q_D( QskSceneTexture );
+
+    if ( on != d->mipmapped )
+    {
+        d->mipmapped = on;
+        d->isConfigDirty = true;
+    }
+}
+
 QSize QskSceneTexture::textureSize() const
 {
     Q_D( const QskSceneTexture );
 
-    QSize size( qCeil( d->rect.width() ), qCeil( d->rect.height() ) );
+    QSize size( qCeil( d->rect.width() * d->renderScale ),
+        qCeil( d->rect.height() * d->renderScale ) );
     size *= d->devicePixelRatio;
 
     const QSize minSize = d->context->sceneGraphContext()->minimumFBOSize();
@@ -349,18 +437,27 @@ QSize QskSceneTexture::textureSize() const
     return size;
 }
 
-void QskSceneTexture::render( const QSGRootNode* rootNode,
+bool QskSceneTexture::render( const QSGRootNode* rootNode,
     const QSGTransformNode* finalNode, const QRectF& rect )
 {
     Q_D( QskSceneTexture );
 
+    if ( d->renderer && !isDirty() && ( rect == d->rect )
+        && ( d->renderer->rootNode() == rootNode )
+        && ( d->renderer->finalNode() == finalNode ) )
+    {
+        // the texture is up to date
+        return false;
+    }
+
     d->rect = rect;
+    d->isConfigDirty = false;
 
     if ( d->renderer == nullptr )
-    {
         d->renderer = new Renderer( this, d->context );
-        d->renderer->setDevicePixelRatio( d->devicePixelRatio );
-    }
+
+    d->renderer->setDevicePixelRatio( d->devicePixelRatio * d->renderScale );
+    d->renderer->setMipmapped( d->mipmapped );
 
     d->renderer->setRootNode( const_cast< QSGRootNode* >( rootNode ) );
     d->renderer->setFinalNode( const_cast< QSGTransformNode* >( finalNode ) );
@@ -368,12 +465,18 @@ void QskSceneTexture::render( const QSGRootNode* rootNode,
     d->renderer->setProjection( d->rect );
     d->renderer->setTextureSize( textureSize() );
     d->renderer->renderScene();
+
+    return true;
 }
 
 bool QskSceneTexture::isDirty() const
 {
     Q_D( const QskSceneTexture );
-    return d->renderer ? d->renderer->isDirty() : true;
+
+    if ( d->renderer == nullptr || d->isConfigDirty )
+        return true;
+
+    return d->renderer->isDirty();
 }
 
 QRectF QskSceneTexture::normalizedTextureSubRect() const
@@ -388,7 +491,7 @@ bool QskSceneTexture::hasAlphaChannel() const
 
 bool QskSceneTexture::hasMipmaps() const
 {
-    return false;
+    return d_func()->mipmapped;
 }
 
 #if QT_VERSION < QT_VERSION_CHECK( 6, 0, 0 )
@@ -32,7 +32,21 @@ class QSK_EXPORT QskSceneTexture : public QSGTexture
     const QSGGeometryNode* textureNode() const;
 #endif
 
-    void render( const QSGRootNode*, const QSGTransformNode*, const QRectF& );
+    /*
+        For effects like blurring a texture with a lower resolution is good enough.
+        The scale is applied on top of the device pixel ratio of the window.
+     */
+    void setRenderScale( qreal );
+    qreal renderScale() const;
+
+    // generating mipmaps after each rendering, f.e for downsampling in shaders
+    void setMipmapped( bool );
+
+    /*
+        Rendering is skipped, when nothing inside the subtree has changed
+        since the previous call. Returns false in this case.
+     */
+    bool render( const QSGRootNode*, const QSGTransformNode*, const QRectF& );
 
     QSize textureSize() const override;
 
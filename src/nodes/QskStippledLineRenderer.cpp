@@ -14,8 +14,10 @@ namespace
     /*
         Thanks to the hooks of the stroker classes we can make use
         of QDashStroker without having to deal with the overhead of
-        QPainterPaths. But it might be worth to check if this could
-        be done in a shader. TODO ...
+        QPainterPaths.
+
+        Simple patterns can also be done in the fragment shader:
+        see QskBasicLinesNode::isShaderStipple
      */
     class DashStroker : public QDashStroker
     {
@@ -15,6 +15,9 @@ class QPointF;
     A wrapper for the non public QDashStroker class, tailored for
     splitting lines into dashes/dots. It is faster than QPainterPathStroker
     ( no QPainterPath involved ), but supports simple lines only.
+
+    It is the fallback for patterns, that can't be done in the
+    fragment shader of QskBasicLinesNode.
  */
 class QskStippledLineRenderer
 {
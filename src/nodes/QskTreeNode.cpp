@@ -4,10 +4,34 @@
  *****************************************************************************/
 
 #include "QskTreeNode.h"
+#include "QskSGNode.h"
 
 static constexpr auto extraFlag =
     static_cast< QSGNode::Flag >( QSGNode::IsVisitableNode << 1 );
 
+static inline int qskRoleSlot( quint8 role )
+{
+    using namespace QskSGNode;
+
+    /*
+        Roles of the skinlets are usually small numbers, while
+        the reserved roles are at the end of the range. So we
+        put background/debug in front and the others behind.
+     */
+
+    switch ( role )
+    {
+        case BackgroundRole:
+            return 0;
+
+        case DebugRole:
+            return 1;
+
+        default:
+            return ( role < FirstReservedRole ) ? role + 2 : -1;
+    }
+}
+
 static inline QSGNode* qskCheckedNode( const QSGNode* node, QSGNode::NodeType type )
 {
     return node && ( node->type() == type ) && ( node->flags() & extraFlag )
@@ -45,6 +69,35 @@ bool QskTreeNode::isSubtreeBlocked() const
     return m_isBlocked;
 }
 
+bool QskTreeNode::isIndexedRole( quint8 role )
+{
+    return qskRoleSlot( role ) >= 0;
+}
+
+QSGNode* QskTreeNode::roleNode( quint8 role ) const
+{
+    const auto slot = qskRoleSlot( role );
+    return ( slot >= 0 && slot < m_roleNodes.size() ) ? m_roleNodes[ slot ] : nullptr;
+}
+
+void QskTreeNode::setRoleNode( quint8 role, QSGNode* node )
+{
+    const auto slot = qskRoleSlot( role );
+    if ( slot < 0 )
+        return;
+
+    if ( slot >= m_roleNodes.size() )
+    {
+        if ( node == nullptr )
+            return;
+
+        while ( m_roleNodes.size() <= slot )
+            m_roleNodes.append( nullptr );
+    }
+
+    m_roleNodes[ slot ] = node;
+}
+
 QskTreeNode* qskTreeNodeCast( QSGNode* node )
 {
     return static_cast< QskTreeNode* >(
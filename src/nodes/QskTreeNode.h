@@ -8,9 +8,17 @@
 
 #include "QskGlobal.h"
 #include <qsgnode.h>
+#include <qvarlengtharray.h>
 
 /*
    Used as paintNode in all QskControls ( see QskControl::updateItemPaintNode )
+
+   The children are usually created by the skinlet and tagged with a node role.
+   To avoid linear lookups QskTreeNode keeps an index role -> node, that
+   is maintained by the functions in QskSGNode. Nodes, that have been
+   inserted or removed using the QSGNode API, are detected by
+   QskSGNode::findChildNode, but a node with a role must not be deleted
+   without QskSGNode::removeChildNode() or updating the index by setRoleNode().
  */
 class QSK_EXPORT QskTreeNode final : public QSGNode
 {
@@ -21,11 +29,17 @@ class QSK_EXPORT QskTreeNode final : public QSGNode
     void setSubtreeBlocked( bool on, bool notify = true );
     bool isSubtreeBlocked() const override;
 
+    static bool isIndexedRole( quint8 role );
+
+    QSGNode* roleNode( quint8 role ) const;
+    void setRoleNode( quint8 role, QSGNode* );
+
   protected:
     QskTreeNode( QSGNodePrivate& );
 
   private:
-    bool m_isBlocked = false;;
+    bool m_isBlocked = false;
+    QVarLengthArray< QSGNode*, 8 > m_roleNodes;
 };
 
 QSK_EXPORT QskTreeNode* qskTreeNodeCast( QSGNode* );
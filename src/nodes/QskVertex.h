@@ -176,6 +176,50 @@ namespace QskVertex
         QSGGeometry::ColoredPoint2D p2;
     };
 
+    /*
+        A point with the distance from the beginning of its line,
+        used for calculating dashes in the fragment shader
+     */
+    class DashPoint
+    {
+      public:
+        inline void set( float x, float y, float distance ) noexcept
+        {
+            this->x = x;
+            this->y = y;
+            this->distance = distance;
+        }
+
+        float x, y;
+        float distance;
+    };
+
+    class DashLine
+    {
+      public:
+        inline void setLine( float x1, float y1, float x2, float y2 ) noexcept
+        {
+            p1.set( x1, y1, 0.0f );
+            p2.set( x2, y2, qSqrt( ( x2 - x1 ) * ( x2 - x1 )
+                + ( y2 - y1 ) * ( y2 - y1 ) ) );
+        }
+
+        inline void setHLine( float x1, float x2, float y ) noexcept
+        {
+            p1.set( x1, y, 0.0f );
+            p2.set( x2, y, qAbs( x2 - x1 ) );
+        }
+
+        inline void setVLine( float x, float y1, float y2 ) noexcept
+        {
+            p1.set( x, y1, 0.0f );
+            p2.set( x, y2, qAbs( y2 - y1 ) );
+        }
+
+        DashPoint p1;
+        DashPoint p2;
+    };
+
     template< class Line >
     static inline Line* allocateLines( QSGGeometry& geometry, int lineCount )
     {
@@ -0,0 +1,33 @@
+#version 440
+
+layout( location = 0 ) in float lineDistance;
+layout( location = 0 ) out vec4 fragColor;
+
+layout( std140, binding = 0 ) uniform buf
+{
+    mat4 matrix;
+    vec4 color;
+    vec2 origin;
+    float offset;
+    float patternLength;
+    vec4 stops[ 2 ];
+} ubuf;
+
+void main()
+{
+    /*
+        stops: the accumulated lengths of dashes and gaps, where
+        unused entries are set to the length of the pattern.
+        Having passed an odd number of stops means being in a gap.
+     */
+
+    vec4 pos = vec4( mod( lineDistance + ubuf.offset, ubuf.patternLength ) );
+
+    float n = dot( step( ubuf.stops[0], pos ), vec4( 1.0 ) )
+        + dot( step( ubuf.stops[1], pos ), vec4( 1.0 ) );
+
+    if ( mod( n, 2.0 ) >= 1.0 )
+        discard;
+
+    fragColor = ubuf.color;
+}
@@ -0,0 +1,20 @@
+uniform lowp vec4 color;
+
+uniform highp float offset;
+uniform highp float patternLength;
+uniform highp vec4 stops[ 2 ];
+
+varying highp float lineDistance;
+
+void main()
+{
+    highp vec4 pos = vec4( mod( lineDistance + offset, patternLength ) );
+
+    highp float n = dot( step( stops[0], pos ), vec4( 1.0 ) )
+        + dot( step( stops[1], pos ), vec4( 1.0 ) );
+
+    if ( mod( n, 2.0 ) >= 1.0 )
+        discard;
+
+    gl_FragColor = color;
+}
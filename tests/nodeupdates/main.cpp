@@ -0,0 +1,161 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) 2016 Uwe Rathmann
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#include <SkinnyNamespace.h>
+
+#include <QskControl.h>
+#include <QskSkinlet.h>
+#include <QskWindow.h>
+
+#include <QtTest>
+#include <qsgnode.h>
+
+class TestControl : public QskControl
+{
+    Q_OBJECT
+
+  public:
+    QSK_SUBCONTROLS( Panel, Text )
+
+    TestControl( QQuickItem* parent = nullptr );
+};
+
+namespace
+{
+    class TestSkinlet : public QskSkinlet
+    {
+      public:
+        enum NodeRole
+        {
+            PanelRole,
+            TextRole,
+
+            RoleCount
+        };
+
+        TestSkinlet()
+        {
+            setOwnedBySkinnable( true );
+
+            setNodeRoles( { PanelRole, TextRole } );
+
+            setNodeRoleSubcontrols( PanelRole, { TestControl::Panel } );
+            setNodeRoleSubcontrols( TextRole, { TestControl::Text } );
+        }
+
+        mutable QVector< quint8 > updatedRoles;
+
+      protected:
+        QSGNode* updateSubNode( const QskSkinnable*,
+            quint8 nodeRole, QSGNode* node ) const override
+        {
+            updatedRoles += nodeRole;
+            return node ? node : new QSGNode();
+        }
+    };
+}
+
+QSK_SUBCONTROL( TestControl, Panel )
+QSK_SUBCONTROL( TestControl, Text )
+
+TestControl::TestControl( QQuickItem* parent )
+    : QskControl( parent )
+{
+    setSkinlet( new TestSkinlet() );
+}
+
+class NodeUpdatesTest : public QObject
+{
+    Q_OBJECT
+
+  private Q_SLOTS:
+    void initTestCase();
+    void init();
+    void cleanup();
+
+    void colorUpdate();
+    void colorAndItemUpdate();
+    void itemAndColorUpdate();
+
+  private:
+    bool waitForFrame();
+    QVector< quint8 > updatedRoles() const;
+
+    QskWindow* m_window = nullptr;
+    TestControl* m_control = nullptr;
+};
+
+void NodeUpdatesTest::initTestCase()
+{
+    Skinny::init();
+}
+
+void NodeUpdatesTest::init()
+{
+    m_window = new QskWindow();
+    m_window->resize( 200, 200 );
+
+    m_control = new TestControl();
+    m_control->setGeometry( 0, 0, 100, 100 );
+
+    m_window->addItem( m_control );
+    m_window->show();
+
+    QVERIFY( QTest::qWaitForWindowExposed( m_window ) );
+    QTRY_VERIFY( !updatedRoles().isEmpty() );
+
+    static_cast< const TestSkinlet* >( m_control->skinlet() )->updatedRoles.clear();
+}
+
+void NodeUpdatesTest::cleanup()
+{
+    delete m_window;
+    m_window = nullptr;
+    m_control = nullptr;
+}
+
+void NodeUpdatesTest::colorUpdate()
+{
+    // what QskHintAnimator does for color animations
+    m_control->markSubcontrolDirty( TestControl::Panel );
+
+    QVERIFY( waitForFrame() );
+    QCOMPARE( updatedRoles(), QVector< quint8 >( { TestSkinlet::PanelRole } ) );
+}
+
+void NodeUpdatesTest::colorAndItemUpdate()
+{
+    m_control->markSubcontrolDirty( TestControl::Panel );
+    static_cast< QQuickItem* >( m_control )->update();
+
+    QVERIFY( waitForFrame() );
+    QCOMPARE( updatedRoles(),
+        QVector< quint8 >( { TestSkinlet::PanelRole, TestSkinlet::TextRole } ) );
+}
+
+void NodeUpdatesTest::itemAndColorUpdate()
+{
+    static_cast< QQuickItem* >( m_control )->update();
+    m_control->markSubcontrolDirty( TestControl::Panel );
+
+    QVERIFY( waitForFrame() );
+    QCOMPARE( updatedRoles(),
+        QVector< quint8 >( { TestSkinlet::PanelRole, TestSkinlet::TextRole } ) );
+}
+
+bool NodeUpdatesTest::waitForFrame()
+{
+    QSignalSpy spy( m_window, &QQuickWindow::frameSwapped );
+    return spy.wait( 1000 );
+}
+
+QVector< quint8 > NodeUpdatesTest::updatedRoles() const
+{
+    return static_cast< const TestSkinlet* >( m_control->skinlet() )->updatedRoles;
+}
+
+QTEST_MAIN( NodeUpdatesTest )
+
+#include "main.moc"
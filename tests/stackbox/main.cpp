@@ -0,0 +1,81 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) 2016 Uwe Rathmann
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#include <QskStackBox.h>
+#include <QskControl.h>
+
+#include <QtTest>
+
+class StackBoxTest : public QObject
+{
+    Q_OBJECT
+
+  private Q_SLOTS:
+    void autoAddedChildren();
+    void pageCreatedWithBoxAsParent();
+    void pageLoaded();
+};
+
+void StackBoxTest::autoAddedChildren()
+{
+    QskStackBox box( true );
+
+    auto item1 = new QskControl( &box );
+    auto item2 = new QskControl( &box );
+
+    QCOMPARE( box.itemCount(), 2 );
+    QCOMPARE( box.indexOf( item1 ), 0 );
+    QCOMPARE( box.indexOf( item2 ), 1 );
+}
+
+void StackBoxTest::pageCreatedWithBoxAsParent()
+{
+    QskStackBox box( true );
+
+    auto item1 = new QskControl( &box );
+
+    QskControl* page = nullptr;
+    box.addPage( [&box, &page]() { return page = new QskControl( &box ); } );
+
+    auto item2 = new QskControl( &box );
+
+    QCOMPARE( box.itemCount(), 3 );
+    QVERIFY( !box.isLoaded( 1 ) );
+
+    box.setCurrentIndex( 1 );
+
+    QVERIFY( page != nullptr );
+    QCOMPARE( box.itemCount(), 3 );
+
+    QCOMPARE( box.itemAtIndex( 0 ), item1 );
+    QCOMPARE( box.itemAtIndex( 1 ), page );
+    QCOMPARE( box.itemAtIndex( 2 ), item2 );
+
+    QCOMPARE( box.currentItem(), page );
+    QVERIFY( page->isVisible() );
+}
+
+void StackBoxTest::pageLoaded()
+{
+    QskStackBox box;
+
+    box.addItem( new QskControl() );
+    box.addPage( []() { return new QskControl(); } );
+
+    QSignalSpy spy( &box, &QskStackBox::pageLoaded );
+
+    box.setCurrentIndex( 1 );
+
+    QCOMPARE( spy.count(), 1 );
+    QCOMPARE( spy[0][0].toInt(), 1 );
+    QCOMPARE( spy[0][1].value< QQuickItem* >(), box.itemAtIndex( 1 ) );
+
+    box.setCurrentIndex( 0 );
+    QCOMPARE( spy.count(), 1 );
+}
+
+QTEST_MAIN( StackBoxTest )
+
+#include "main.moc"
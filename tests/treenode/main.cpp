@@ -0,0 +1,109 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) 2016 Uwe Rathmann
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#include <QskSGNode.h>
+#include <QskTreeNode.h>
+
+#include <QtTest>
+
+class TreeNodeTest : public QObject
+{
+    Q_OBJECT
+
+  private Q_SLOTS:
+    void indexedLookup();
+    void appendedByQSGNode();
+    void removedByQSGNode();
+    void replacedByQSGNode();
+};
+
+static QSGNode* qskRoleNode( quint8 role )
+{
+    return QskSGNode::createNode< QSGNode >( role );
+}
+
+void TreeNodeTest::indexedLookup()
+{
+    const QVector< quint8 > roles = { 0, 1, 2 };
+
+    QskTreeNode parentNode;
+
+    auto node1 = qskRoleNode( 1 );
+    QskSGNode::replaceChildNode( roles, 1, &parentNode, nullptr, node1 );
+
+    auto node0 = qskRoleNode( 0 );
+    QskSGNode::replaceChildNode( roles, 0, &parentNode, nullptr, node0 );
+
+    QCOMPARE( parentNode.roleNode( 0 ), node0 );
+    QCOMPARE( parentNode.roleNode( 1 ), node1 );
+
+    QCOMPARE( parentNode.firstChild(), node0 );
+    QCOMPARE( QskSGNode::findChildNode( &parentNode, 1 ), node1 );
+    QCOMPARE( QskSGNode::findChildNode( &parentNode, 2 ), nullptr );
+
+    QVERIFY( QskSGNode::removeChildNode( &parentNode, 1 ) );
+    QCOMPARE( parentNode.roleNode( 1 ), nullptr );
+    QCOMPARE( QskSGNode::findChildNode( &parentNode, 1 ), nullptr );
+}
+
+void TreeNodeTest::appendedByQSGNode()
+{
+    QskTreeNode parentNode;
+
+    auto node = qskRoleNode( 1 );
+    parentNode.appendChildNode( node );
+
+    QCOMPARE( parentNode.roleNode( 1 ), nullptr );
+    QCOMPARE( QskSGNode::findChildNode( &parentNode, 1 ), node );
+
+    // now being indexed
+    QCOMPARE( parentNode.roleNode( 1 ), node );
+}
+
+void TreeNodeTest::removedByQSGNode()
+{
+    const QVector< quint8 > roles = { 0, 1 };
+
+    QskTreeNode parentNode;
+
+    auto node = qskRoleNode( 1 );
+    QskSGNode::replaceChildNode( roles, 1, &parentNode, nullptr, node );
+
+    parentNode.removeChildNode( node );
+
+    QCOMPARE( QskSGNode::findChildNode( &parentNode, 1 ), nullptr );
+    QCOMPARE( parentNode.roleNode( 1 ), nullptr );
+
+    // appended to another parent
+
+    QSGNode otherNode;
+    otherNode.appendChildNode( node );
+
+    QCOMPARE( QskSGNode::findChildNode( &parentNode, 1 ), nullptr );
+    QCOMPARE( QskSGNode::findChildNode( &otherNode, 1 ), node );
+}
+
+void TreeNodeTest::replacedByQSGNode()
+{
+    const QVector< quint8 > roles = { 0, 1 };
+
+    QskTreeNode parentNode;
+
+    auto oldNode = qskRoleNode( 1 );
+    QskSGNode::replaceChildNode( roles, 1, &parentNode, nullptr, oldNode );
+
+    auto newNode = qskRoleNode( 1 );
+    parentNode.insertChildNodeAfter( newNode, oldNode );
+    parentNode.removeChildNode( oldNode );
+
+    QCOMPARE( QskSGNode::findChildNode( &parentNode, 1 ), newNode );
+    QCOMPARE( parentNode.roleNode( 1 ), newNode );
+
+    delete oldNode;
+}
+
+QTEST_MAIN( TreeNodeTest )
+
+#include "main.moc"